@@ -0,0 +1,226 @@
+#ifndef VECT4F_H
+#define VECT4F_H
+
+#include "common/inc/Vectors.hpp"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define VECT4F_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+#define VECT4F_NEON
+#include <arm_neon.h>
+#endif
+
+// Four floats in one SIMD register (SSE, NEON, or a plain array elsewhere) with the vect3_t API on x, y, z.
+// w rides along: 1 for points, 0 for directions, and dot/cross/magnitude ignore it.
+// Every lane operation and the (x + y) + z order of dot() match vect3_t<float> bit for bit, so swapping one
+// for the other never moves a pixel.
+struct alignas(16) vect4f_t
+{
+#if defined(VECT4F_SSE)
+    using native_t = __m128;
+#elif defined(VECT4F_NEON)
+    using native_t = float32x4_t;
+#else
+    struct native_t
+    {
+        float lanes[4];
+    };
+#endif
+
+    native_t v;
+
+    vect4f_t() : vect4f_t(0.0f, 0.0f, 0.0f, 0.0f) {}
+    explicit vect4f_t(const native_t native) : v(native) {}
+
+    vect4f_t(const float x, const float y, const float z, const float w)
+#if defined(VECT4F_SSE)
+        : v(_mm_setr_ps(x, y, z, w)) {}
+#elif defined(VECT4F_NEON)
+    {
+        const float lanes[4]{x, y, z, w};
+        v = vld1q_f32(lanes);
+    }
+#else
+        : v{{x, y, z, w}} {}
+#endif
+
+    vect4f_t(const vect3_t<float>& xyz, const float w) : vect4f_t(xyz.x, xyz.y, xyz.z, w) {}
+
+    static vect4f_t splat(const float value)
+    {
+#if defined(VECT4F_SSE)
+        return vect4f_t{_mm_set1_ps(value)};
+#elif defined(VECT4F_NEON)
+        return vect4f_t{vdupq_n_f32(value)};
+#else
+        return {value, value, value, value};
+#endif
+    }
+
+    // Four consecutive floats, no alignment required
+    static vect4f_t load(const float* source)
+    {
+#if defined(VECT4F_SSE)
+        return vect4f_t{_mm_loadu_ps(source)};
+#elif defined(VECT4F_NEON)
+        return vect4f_t{vld1q_f32(source)};
+#else
+        return {source[0], source[1], source[2], source[3]};
+#endif
+    }
+
+    void store(float* destination) const
+    {
+#if defined(VECT4F_SSE)
+        _mm_storeu_ps(destination, v);
+#elif defined(VECT4F_NEON)
+        vst1q_f32(destination, v);
+#else
+        for (int i = 0; i < 4; ++i)
+        {
+            destination[i] = v.lanes[i];
+        }
+#endif
+    }
+
+    template <int LANE>
+    [[nodiscard]] float lane() const
+    {
+        static_assert(LANE >= 0 && LANE < 4, "vect4f_t has 4 lanes");
+#if defined(VECT4F_SSE)
+        return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(LANE, LANE, LANE, LANE)));
+#elif defined(VECT4F_NEON)
+        return vgetq_lane_f32(v, LANE);
+#else
+        return v.lanes[LANE];
+#endif
+    }
+
+    [[nodiscard]] float x() const { return lane<0>(); }
+    [[nodiscard]] float y() const { return lane<1>(); }
+    [[nodiscard]] float z() const { return lane<2>(); }
+    [[nodiscard]] float w() const { return lane<3>(); }
+
+    [[nodiscard]] vect3_t<float> toVect3() const { return {x(), y(), z()}; }
+
+    // One lane copied to all four
+    template <int LANE>
+    [[nodiscard]] vect4f_t broadcast() const
+    {
+#if defined(VECT4F_SSE)
+        return vect4f_t{_mm_shuffle_ps(v, v, _MM_SHUFFLE(LANE, LANE, LANE, LANE))};
+#elif defined(VECT4F_NEON)
+        return vect4f_t{vdupq_n_f32(vgetq_lane_f32(v, LANE))};
+#else
+        return splat(v.lanes[LANE]);
+#endif
+    }
+
+    // Lanes reordered, result lane i is this lane Ii
+    template <int I0, int I1, int I2, int I3>
+    [[nodiscard]] vect4f_t permute() const
+    {
+#if defined(VECT4F_SSE)
+        return vect4f_t{_mm_shuffle_ps(v, v, _MM_SHUFFLE(I3, I2, I1, I0))};
+#else
+        return {lane<I0>(), lane<I1>(), lane<I2>(), lane<I3>()};
+#endif
+    }
+
+    vect4f_t operator+(const vect4f_t& other) const
+    {
+#if defined(VECT4F_SSE)
+        return vect4f_t{_mm_add_ps(v, other.v)};
+#elif defined(VECT4F_NEON)
+        return vect4f_t{vaddq_f32(v, other.v)};
+#else
+        return {v.lanes[0] + other.v.lanes[0], v.lanes[1] + other.v.lanes[1],
+                v.lanes[2] + other.v.lanes[2], v.lanes[3] + other.v.lanes[3]};
+#endif
+    }
+
+    vect4f_t operator-(const vect4f_t& other) const
+    {
+#if defined(VECT4F_SSE)
+        return vect4f_t{_mm_sub_ps(v, other.v)};
+#elif defined(VECT4F_NEON)
+        return vect4f_t{vsubq_f32(v, other.v)};
+#else
+        return {v.lanes[0] - other.v.lanes[0], v.lanes[1] - other.v.lanes[1],
+                v.lanes[2] - other.v.lanes[2], v.lanes[3] - other.v.lanes[3]};
+#endif
+    }
+
+    // Lane by lane
+    vect4f_t operator*(const vect4f_t& other) const
+    {
+#if defined(VECT4F_SSE)
+        return vect4f_t{_mm_mul_ps(v, other.v)};
+#elif defined(VECT4F_NEON)
+        return vect4f_t{vmulq_f32(v, other.v)};
+#else
+        return {v.lanes[0] * other.v.lanes[0], v.lanes[1] * other.v.lanes[1],
+                v.lanes[2] * other.v.lanes[2], v.lanes[3] * other.v.lanes[3]};
+#endif
+    }
+
+    // Lane by lane
+    vect4f_t operator/(const vect4f_t& other) const
+    {
+#if defined(VECT4F_SSE)
+        return vect4f_t{_mm_div_ps(v, other.v)};
+#elif defined(VECT4F_NEON) && defined(__aarch64__)
+        return vect4f_t{vdivq_f32(v, other.v)};
+#else
+        return {x() / other.x(), y() / other.y(), z() / other.z(), w() / other.w()};
+#endif
+    }
+
+    vect4f_t operator*(const float scalar) const { return *this * splat(scalar); }
+
+    friend vect4f_t operator*(const float scalar, const vect4f_t& vector) { return splat(scalar) * vector; }
+
+    [[nodiscard]] float dot(const vect4f_t& other) const
+    {
+        const vect4f_t product = *this * other;
+        return product.x() + product.y() + product.z();
+    }
+
+    [[nodiscard]] vect4f_t cross(const vect4f_t& other) const
+    {
+        return permute<1, 2, 0, 3>() * other.permute<2, 0, 1, 3>()
+             - permute<2, 0, 1, 3>() * other.permute<1, 2, 0, 3>();
+    }
+
+    [[nodiscard]] float magnitudeSquared() const { return dot(*this); }
+
+    [[nodiscard]] float magnitude() const { return std::sqrt(magnitudeSquared()); }
+
+    [[nodiscard]] vect4f_t normalize() const { return *this * (1.0f / magnitude()); }
+
+    [[nodiscard]] float sum() const { return x() + y() + z(); }
+};
+
+// Column-major 4x4 matrix, laid out like glm::mat4 so one loads straight from the other's storage
+struct mat4f_t
+{
+    vect4f_t columns[4];
+
+    static mat4f_t load(const float* columnMajor)
+    {
+        return {{vect4f_t::load(columnMajor), vect4f_t::load(columnMajor + 4),
+                 vect4f_t::load(columnMajor + 8), vect4f_t::load(columnMajor + 12)}};
+    }
+
+    // Same operation order as glm's matrix * vector, so results are identical
+    [[nodiscard]] vect4f_t transform(const vect4f_t& vector) const
+    {
+        return (columns[0] * vector.broadcast<0>() + columns[1] * vector.broadcast<1>())
+             + (columns[2] * vector.broadcast<2>() + columns[3] * vector.broadcast<3>());
+    }
+};
+
+#endif //VECT4F_H
@@ -0,0 +1,156 @@
+#ifndef VECT8F_H
+#define VECT8F_H
+
+#include <cstdint>
+
+#if defined(__AVX__)
+#define VECT8F_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#define VECT8F_SSE
+#include <emmintrin.h>
+#endif
+
+// Eight independent float lanes for batch kernels that work on 8 faces or vertices at a time: one AVX register,
+// two SSE registers, or a plain array the compiler may vectorize. Comparisons return a lane mask, bit i set
+// when lane i passed, so results combine with plain integer & and | and compact with countr_zero.
+struct vect8f_t
+{
+#if defined(VECT8F_AVX)
+    __m256 v;
+#elif defined(VECT8F_SSE)
+    __m128 low;
+    __m128 high;
+#else
+    float lanes[8];
+#endif
+
+    static vect8f_t splat(const float value)
+    {
+#if defined(VECT8F_AVX)
+        return {_mm256_set1_ps(value)};
+#elif defined(VECT8F_SSE)
+        return {_mm_set1_ps(value), _mm_set1_ps(value)};
+#else
+        return {{value, value, value, value, value, value, value, value}};
+#endif
+    }
+
+    // Eight consecutive floats, no alignment required
+    static vect8f_t load(const float* source)
+    {
+#if defined(VECT8F_AVX)
+        return {_mm256_loadu_ps(source)};
+#elif defined(VECT8F_SSE)
+        return {_mm_loadu_ps(source), _mm_loadu_ps(source + 4)};
+#else
+        vect8f_t result;
+        for (int i = 0; i < 8; ++i)
+        {
+            result.lanes[i] = source[i];
+        }
+        return result;
+#endif
+    }
+
+    void store(float* destination) const
+    {
+#if defined(VECT8F_AVX)
+        _mm256_storeu_ps(destination, v);
+#elif defined(VECT8F_SSE)
+        _mm_storeu_ps(destination, low);
+        _mm_storeu_ps(destination + 4, high);
+#else
+        for (int i = 0; i < 8; ++i)
+        {
+            destination[i] = lanes[i];
+        }
+#endif
+    }
+
+    vect8f_t operator+(const vect8f_t& other) const
+    {
+#if defined(VECT8F_AVX)
+        return {_mm256_add_ps(v, other.v)};
+#elif defined(VECT8F_SSE)
+        return {_mm_add_ps(low, other.low), _mm_add_ps(high, other.high)};
+#else
+        vect8f_t result;
+        for (int i = 0; i < 8; ++i)
+        {
+            result.lanes[i] = lanes[i] + other.lanes[i];
+        }
+        return result;
+#endif
+    }
+
+    vect8f_t operator-(const vect8f_t& other) const
+    {
+#if defined(VECT8F_AVX)
+        return {_mm256_sub_ps(v, other.v)};
+#elif defined(VECT8F_SSE)
+        return {_mm_sub_ps(low, other.low), _mm_sub_ps(high, other.high)};
+#else
+        vect8f_t result;
+        for (int i = 0; i < 8; ++i)
+        {
+            result.lanes[i] = lanes[i] - other.lanes[i];
+        }
+        return result;
+#endif
+    }
+
+    vect8f_t operator*(const vect8f_t& other) const
+    {
+#if defined(VECT8F_AVX)
+        return {_mm256_mul_ps(v, other.v)};
+#elif defined(VECT8F_SSE)
+        return {_mm_mul_ps(low, other.low), _mm_mul_ps(high, other.high)};
+#else
+        vect8f_t result;
+        for (int i = 0; i < 8; ++i)
+        {
+            result.lanes[i] = lanes[i] * other.lanes[i];
+        }
+        return result;
+#endif
+    }
+
+    // Lanes where this < other; false for NaN like the scalar comparison
+    [[nodiscard]] uint32_t lessThan(const vect8f_t& other) const
+    {
+#if defined(VECT8F_AVX)
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(v, other.v, _CMP_LT_OQ)));
+#elif defined(VECT8F_SSE)
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(low, other.low)))
+             | static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(high, other.high))) << 4u;
+#else
+        uint32_t mask{0};
+        for (int i = 0; i < 8; ++i)
+        {
+            mask |= static_cast<uint32_t>(lanes[i] < other.lanes[i]) << i;
+        }
+        return mask;
+#endif
+    }
+
+    // Lanes where this <= other; false for NaN like the scalar comparison
+    [[nodiscard]] uint32_t lessEqual(const vect8f_t& other) const
+    {
+#if defined(VECT8F_AVX)
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(v, other.v, _CMP_LE_OQ)));
+#elif defined(VECT8F_SSE)
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(low, other.low)))
+             | static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(high, other.high))) << 4u;
+#else
+        uint32_t mask{0};
+        for (int i = 0; i < 8; ++i)
+        {
+            mask |= static_cast<uint32_t>(lanes[i] <= other.lanes[i]) << i;
+        }
+        return mask;
+#endif
+    }
+};
+
+#endif //VECT8F_H
@@ -0,0 +1,73 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <common/inc/Vect4f.hpp>
+
+#include "doctest/doctest.h"
+
+#include <array>
+#include <random>
+
+namespace
+{
+    std::array<vect3_t<float>, 64> randomVectors()
+    {
+        std::mt19937 generator{42u};
+        std::uniform_real_distribution<float> distribution{-100.0f, 100.0f};
+        std::array<vect3_t<float>, 64> vectors{};
+        for (auto& vector : vectors)
+        {
+            vector = {distribution(generator), distribution(generator), distribution(generator)};
+        }
+        return vectors;
+    }
+
+    void checkSame(const vect4f_t& actual, const vect3_t<float>& expected)
+    {
+        CHECK(actual.x() == expected.x);
+        CHECK(actual.y() == expected.y);
+        CHECK(actual.z() == expected.z);
+    }
+}
+
+TEST_CASE("vect4f_t matches vect3_t bit for bit")
+{
+    const auto vectors = randomVectors();
+    for (size_t i = 0; i + 1 < vectors.size(); ++i)
+    {
+        const auto& a = vectors[i];
+        const auto& b = vectors[i + 1];
+        const vect4f_t a4{a, 1.0f};
+        const vect4f_t b4{b, 0.0f};
+
+        checkSame(a4 + b4, a + b);
+        checkSame(a4 - b4, a - b);
+        checkSame(a4 * 0.37f, a * 0.37f);
+        checkSame(a4.cross(b4), a.cross(b));
+        checkSame(a4.normalize(), a.normalize());
+        CHECK(a4.dot(b4) == a.dot(b));
+        CHECK(a4.magnitude() == a.magnitude());
+    }
+}
+
+TEST_CASE("mat4f_t transforms column-major points")
+{
+    // Scale by 2, then translate by (1, 2, 3)
+    constexpr std::array<float, 16> columnMajor{2, 0, 0, 0,
+                                                0, 2, 0, 0,
+                                                0, 0, 2, 0,
+                                                1, 2, 3, 1};
+    const auto matrix = mat4f_t::load(columnMajor.data());
+
+    const vect4f_t point = matrix.transform({0.5f, -1.0f, 4.0f, 1.0f});
+    CHECK(point.x() == 2.0f);
+    CHECK(point.y() == 0.0f);
+    CHECK(point.z() == 11.0f);
+    CHECK(point.w() == 1.0f);
+
+    // Directions ignore the translation
+    const vect4f_t direction = matrix.transform({0.5f, -1.0f, 4.0f, 0.0f});
+    CHECK(direction.x() == 1.0f);
+    CHECK(direction.y() == -2.0f);
+    CHECK(direction.z() == 8.0f);
+    CHECK(direction.w() == 0.0f);
+}
@@ -3,6 +3,8 @@
 
 #include "common/inc/Vectors.hpp"
 
+#include <numbers>
+
 struct Camera
 {
     vect3_t<float> _position{0.0f,0.0f,0.0f};
@@ -11,24 +13,25 @@ struct Camera
     float _yaw = 0.0f;
     float _pitch = 0.0f;
 
-    void updateTick(const float deltaTimeSec, glm::vec3& target)
+    void updateTick(const float deltaTimeSec)
     {
         _position.y += _velocity.y * deltaTimeSec;
 
         const auto forwardVelocity = _direction * _velocity.x * deltaTimeSec;
         _position = _position + forwardVelocity;
 
-        // Rotation around Y axis
-        auto cameraRotation = glm::mat3(1.0f);
-        const auto rotationY = glm::mat3(glm::rotate(glm::mat4(1.0f), glm::radians(_yaw), glm::vec3(0,1,0)));
-        const auto rotationX = glm::mat3(glm::rotate(glm::mat4(1.0f), glm::radians(_pitch), glm::vec3(1,0,0)));
-        cameraRotation = cameraRotation * rotationY * rotationX;
-
-        // Rotate the forward direction
-        _direction = from_glm(cameraRotation * to_glm(_direction));
+        // Rotate the forward direction: pitch around X, then yaw around Y
+        constexpr float DEGREES_TO_RADIANS = std::numbers::pi_v<float> / 180.0f;
+        _direction = _direction.rotateX(_pitch * DEGREES_TO_RADIANS).rotateY(_yaw * DEGREES_TO_RADIANS);
+    }
 
-        // Update target based on new position + direction
-        target = to_glm(_position + _direction);
+    // Camera seen between two fixed simulation steps, alpha = 0 is previous and 1 is current
+    static Camera interpolate(const Camera& previous, const Camera& current, const float alpha)
+    {
+        Camera blended = current;
+        blended._position = previous._position + (current._position - previous._position) * alpha;
+        blended._direction = (previous._direction + (current._direction - previous._direction) * alpha).normalize();
+        return blended;
     }
 };
 
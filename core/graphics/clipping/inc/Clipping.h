@@ -3,8 +3,10 @@
 
 #include <array>
 #include <functional>
+#include <limits>
 #include <vector>
 
+#include <common/inc/Vect4f.hpp>
 #include <common/inc/Vectors.hpp>
 #include "graphics/textures/inc/Textures.h"
 
@@ -20,6 +22,9 @@ enum PlanesNames : size_t
 };
 
 constexpr size_t MAX_NUM_POLY_VERTICES = 10;
+
+// A point counts as inside a plane down to this signed distance below it
+constexpr float CLIPPING_EPSILON = std::numeric_limits<float>::epsilon() * 10;
 static constexpr size_t TRIANGLE_VERTICES_COUNT = 3;
 
 struct Plane
@@ -28,15 +33,17 @@ struct Plane
     vect3_t<float> norm{};
 };
 
+// View-space points kept in SIMD registers with w = 1 while they go through the planes
 struct Polygon
 {
-    std::array<vect3_t<float>, MAX_NUM_POLY_VERTICES> vertices{};
+    std::array<vect4f_t, MAX_NUM_POLY_VERTICES> vertices{};
     std::array<Texture2d, MAX_NUM_POLY_VERTICES> texCoords{};
     size_t numVertices{};
     Polygon() = default;
     explicit Polygon(std::array<vect3_t<float>, TRIANGLE_VERTICES_COUNT>& triangleVert , std::array<Texture2d, TRIANGLE_VERTICES_COUNT> triTexCoords);
+    Polygon(const std::array<vect4f_t, TRIANGLE_VERTICES_COUNT>& triangleVert, const std::array<Texture2d, TRIANGLE_VERTICES_COUNT>& triTexCoords);
 
-    [[nodiscard]] std::vector<std::array<vect3_t<float>, TRIANGLE_VERTICES_COUNT>>  polygon2Triangles() const;
+    [[nodiscard]] std::vector<std::array<vect4f_t, TRIANGLE_VERTICES_COUNT>>  polygon2Triangles() const;
     [[nodiscard]] std::vector<std::array<Texture2d, TRIANGLE_VERTICES_COUNT>>  polygon2TrianglesTex() const;
 };
 
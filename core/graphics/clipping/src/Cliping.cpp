@@ -2,6 +2,8 @@
 
 #include "logger/LogHelper.h"
 
+#include <algorithm>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Frustum planes are defined by a point and a normal vector
 ///////////////////////////////////////////////////////////////////////////////
@@ -76,15 +78,17 @@ void Frustum::clipAgainstPlanes(const Plane &plane, Polygon &polygon)
         return;
     }
 
-    std::array<vect3_t<float>, MAX_NUM_POLY_VERTICES> insideVertices{};
+    std::array<vect4f_t, MAX_NUM_POLY_VERTICES> insideVertices{};
     std::array<Texture2d, MAX_NUM_POLY_VERTICES> insideTexCoords{};
     std::size_t insideCount = 0u;
 
-    auto signedDistance = [&plane](const vect3_t<float>& p) {
-        return (p - plane.point).dot(plane.norm);
+    const vect4f_t planePoint{plane.point, 0.0f};
+    const vect4f_t planeNorm{plane.norm, 0.0f};
+    auto signedDistance = [&planePoint, &planeNorm](const vect4f_t& p) {
+        return (p - planePoint).dot(planeNorm);
     };
 
-    constexpr float EPSILON = std::numeric_limits<float>::epsilon() * 10;
+    constexpr float EPSILON = CLIPPING_EPSILON;
     auto isInside = [&](const float d) {
         return d >= -EPSILON;
     };
@@ -126,7 +130,7 @@ void Frustum::clipAgainstPlanes(const Plane &plane, Polygon &polygon)
 
             const float t = previousDist / denom;
 
-            const vect3_t<float> intersectionPos = previousPos + (currentPos - previousPos) * t;
+            const vect4f_t intersectionPos = previousPos + (currentPos - previousPos) * t;
             const Texture2d intersectionUV = lerpUV(previousUV, currentUV, t);
 
             if (insideCount < MAX_NUM_POLY_VERTICES)
@@ -158,15 +162,22 @@ void Frustum::clipAgainstPlanes(const Plane &plane, Polygon &polygon)
 }
 
 Polygon::Polygon(std::array<vect3_t<float>, TRIANGLE_VERTICES_COUNT> &triangleVert, std::array<Texture2d, TRIANGLE_VERTICES_COUNT> triTexCoords)
+{
+    std::ranges::transform(triangleVert, vertices.begin(), [](const vect3_t<float>& vertex) { return vect4f_t{vertex, 1.0f}; });
+    std::ranges::copy_n(triTexCoords.begin(), TRIANGLE_VERTICES_COUNT, texCoords.begin());
+    numVertices = TRIANGLE_VERTICES_COUNT;
+}
+
+Polygon::Polygon(const std::array<vect4f_t, TRIANGLE_VERTICES_COUNT>& triangleVert, const std::array<Texture2d, TRIANGLE_VERTICES_COUNT>& triTexCoords)
 {
     std::ranges::copy_n(triangleVert.begin(), TRIANGLE_VERTICES_COUNT, vertices.begin());
     std::ranges::copy_n(triTexCoords.begin(), TRIANGLE_VERTICES_COUNT, texCoords.begin());
     numVertices = TRIANGLE_VERTICES_COUNT;
 }
 
-std::vector<std::array<vect3_t<float>, 3>> Polygon::polygon2Triangles() const
+std::vector<std::array<vect4f_t, 3>> Polygon::polygon2Triangles() const
 {
-    std::vector<std::array<vect3_t<float>, 3>> triangles;
+    std::vector<std::array<vect4f_t, 3>> triangles;
 
     if (numVertices < 3)
         return triangles;
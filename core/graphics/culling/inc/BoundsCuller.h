@@ -0,0 +1,31 @@
+#ifndef BOUNDSCULLER_H
+#define BOUNDSCULLER_H
+
+#include "graphics/clipping/inc/Clipping.h"
+
+#include <array>
+
+#include "glm/mat4x4.hpp"
+
+struct Mesh;
+
+namespace Culling
+{
+
+enum class Containment
+{
+    OUTSIDE,        // Nothing of the mesh can be visible, skip it
+    INTERSECTING,   // Some faces may cross a plane, cull and clip face by face
+    INSIDE          // Every vertex is inside every plane, no face needs the frustum test or clipping
+};
+
+// Classifies a whole mesh against the view-space frustum planes before any of its faces is touched: first its
+// bounding sphere, then, when the sphere straddles a plane, the eight corners of its box. Both volumes are moved
+// by the model-view matrix, so the answer holds for the transformed vertices. The plane test is the clipper's
+// signed distance with a small margin, so a mesh is only INSIDE or OUTSIDE when every face agrees with it.
+[[nodiscard]] Containment classifyMesh(const Mesh& mesh, const glm::mat4x4& modelView,
+                                       const std::array<Plane, PlanesNames::NUMBER_OF_PLANES>& planes);
+
+}
+
+#endif //BOUNDSCULLER_H
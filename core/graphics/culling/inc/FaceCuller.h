@@ -0,0 +1,35 @@
+#ifndef FACECULLER_H
+#define FACECULLER_H
+
+#include "graphics/clipping/inc/Clipping.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+struct Face;
+struct TransformedVertexStream;
+
+namespace Culling
+{
+
+// A face that survived culling; faces with every corner inside the frustum go straight to projection
+struct VisibleFace
+{
+    uint32_t index{0};
+    bool needsClip{false};
+};
+
+// Classifies the faces of a mesh 8 at a time from their view-space corners, before any clipping.
+// A face is dropped when it faces away from the camera (the unnormalized normal against the camera
+// vector) or when all three corners lie outside the same frustum plane. Every other face is appended
+// to visible in order, flagged when a corner is outside some plane and the clipper has to look at it.
+// The plane test is the clipper's own signed distance, so the trivial cases match what clipping would produce.
+// No planes for a mesh already known to be inside the frustum: only facing is tested and nothing is flagged.
+void cullFaces(const std::vector<Face>& faces, const TransformedVertexStream& viewVertices,
+               std::span<const Plane> planes, bool isBackFaceCullingEnabled,
+               std::vector<VisibleFace>& visible);
+
+}
+
+#endif //FACECULLER_H
@@ -0,0 +1,80 @@
+#ifndef OCCLUSIONCULLER_H
+#define OCCLUSIONCULLER_H
+
+#include "common/inc/Vectors.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "glm/mat4x4.hpp"
+
+struct Mesh;
+struct BoundingBox;
+
+namespace Culling
+{
+
+constexpr size_t OCCLUSION_BUFFER_WIDTH = 320u;
+constexpr size_t OCCLUSION_BUFFER_HEIGHT = 180u;
+
+// Low resolution software occlusion buffer of view-space depth. Only the front faces of an occluder are
+// rasterized, and a pixel only starts occluding when it is certainly covered: its centre is inside one of
+// them and no silhouette edge of the mesh, an edge with a single visible face, passes through it. Such a
+// pixel lies wholly inside the occluder's outline, so the faces sharing inner edges close their seams between
+// them without any coverage being guessed from samples. It occludes at the farthest corner of every face
+// touching it, which keeps the buffer conservative: a box is reported hidden only if it is hidden at full
+// resolution too. Depth is view-space z, so no projection precision is lost at low resolution.
+class OcclusionCuller
+{
+public:
+    explicit OcclusionCuller(size_t width = OCCLUSION_BUFFER_WIDTH, size_t height = OCCLUSION_BUFFER_HEIGHT);
+
+    void beginFrame(const glm::mat4x4& projection, float zNear);
+
+    void rasterizeOccluder(const Mesh& mesh, const glm::mat4x4& modelView);
+
+    // False when the model-space box is entirely behind occluders or entirely off screen
+    [[nodiscard]] bool isVisible(const BoundingBox& bounds, const glm::mat4x4& modelView) const;
+
+private:
+    struct ScreenVertex
+    {
+        float x{0.0f};
+        float y{0.0f};
+        float viewZ{0.0f};
+    };
+
+    struct PixelRect
+    {
+        int x0{0};
+        int y0{0};
+        int x1{-1};
+        int y1{-1};
+    };
+
+    [[nodiscard]] ScreenVertex toScreen(const glm::vec4& viewPosition) const;
+    [[nodiscard]] PixelRect pixelsUnder(float minX, float minY, float maxX, float maxY) const;
+    void rasterizeFace(const ScreenVertex& a, ScreenVertex b, ScreenVertex c);
+    void markSilhouette(const ScreenVertex& from, const ScreenVertex& to);
+
+    size_t _width;
+    size_t _height;
+    glm::mat4x4 _projection{1.0f};
+    float _zNear{0.1f};
+
+    std::vector<float> _occluderDepth;   // Depth behind which the pixel hides everything, +inf until covered
+
+    // Scratch for one occluder, kept between calls so rasterizing does not allocate
+    std::vector<glm::vec4> _viewVertices;
+    std::vector<ScreenVertex> _screenVertices;
+    std::vector<uint8_t> _isFrontFace;
+    std::vector<uint8_t> _frontFacesPerEdge;
+    std::vector<uint8_t> _meshCoverage;  // 1 covered by a front face, 2 crossed by a silhouette edge
+    std::vector<float> _meshDepth;       // Farthest corner of the front faces touching the pixel
+    PixelRect _meshRect;
+};
+
+}
+
+#endif //OCCLUSIONCULLER_H
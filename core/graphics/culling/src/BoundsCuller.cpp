@@ -0,0 +1,88 @@
+#include "graphics/culling/inc/BoundsCuller.h"
+
+#include "graphics/shapes/inc/Mesh.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Past the clipper's own epsilon, for the rounding between these transforms and the vertex stream's
+    constexpr float BOUNDS_MARGIN = 1e-3f;
+
+    float signedDistance(const glm::vec3& point, const Plane& plane)
+    {
+        return (point.x - plane.point.x) * plane.norm.x
+             + (point.y - plane.point.y) * plane.norm.y
+             + (point.z - plane.point.z) * plane.norm.z;
+    }
+
+    // Longest axis of the model-view matrix, how much a radius can grow under it
+    float maxScale(const glm::mat4x4& modelView)
+    {
+        float lengthSquared{0.0f};
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const auto& column = modelView[axis];
+            lengthSquared = std::max(lengthSquared, column.x * column.x + column.y * column.y + column.z * column.z);
+        }
+        return std::sqrt(lengthSquared);
+    }
+}
+
+namespace Culling
+{
+
+Containment classifyMesh(const Mesh& mesh, const glm::mat4x4& modelView,
+                         const std::array<Plane, PlanesNames::NUMBER_OF_PLANES>& planes)
+{
+    const auto& [sphereCenter, sphereRadius] = mesh.sphere;
+    const glm::vec3 center{modelView * glm::vec4{sphereCenter.x, sphereCenter.y, sphereCenter.z, 1.0f}};
+    const float radius = sphereRadius * maxScale(modelView) + BOUNDS_MARGIN;
+
+    bool isSphereInside{true};
+    for (const auto& plane : planes)
+    {
+        const float distance = signedDistance(center, plane);
+        // Not inside rather than below, a NaN distance falls through to the box test
+        if (distance < -CLIPPING_EPSILON - radius)
+        {
+            return Containment::OUTSIDE;
+        }
+        isSphereInside = isSphereInside && distance >= radius;
+    }
+    if (isSphereInside)
+    {
+        return Containment::INSIDE;
+    }
+
+    // The sphere straddles some plane, the box is tighter for long or flat meshes
+    std::array<glm::vec3, 8> corners{};
+    std::ranges::transform(mesh.bounds.corners(), corners.begin(), [&modelView](const vect3_t<float>& corner)
+    {
+        return glm::vec3{modelView * glm::vec4{corner.x, corner.y, corner.z, 1.0f}};
+    });
+
+    bool isBoxInside{true};
+    for (const auto& plane : planes)
+    {
+        size_t outside{0};
+        size_t inside{0};
+        for (const auto& corner : corners)
+        {
+            const float distance = signedDistance(corner, plane);
+            outside += distance < -CLIPPING_EPSILON - BOUNDS_MARGIN ? 1u : 0u;
+            inside += distance >= BOUNDS_MARGIN ? 1u : 0u;
+        }
+
+        if (outside == corners.size())
+        {
+            return Containment::OUTSIDE;
+        }
+        isBoxInside = isBoxInside && inside == corners.size();
+    }
+
+    return isBoxInside ? Containment::INSIDE : Containment::INTERSECTING;
+}
+
+}
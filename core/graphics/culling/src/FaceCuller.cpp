@@ -0,0 +1,129 @@
+#include "graphics/culling/inc/FaceCuller.h"
+
+#include "common/inc/Vect8f.hpp"
+#include "graphics/shapes/inc/Triangle.h"
+#include "graphics/shapes/inc/VertexStream.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace
+{
+    constexpr size_t BATCH_SIZE = 8u;
+    constexpr uint32_t ALL_LANES = (1u << BATCH_SIZE) - 1u;
+
+    // Same tolerance as the normalized test it replaces: a face is kept down to
+    // dot(normal / |normal|, camera) >= -epsilon, i.e. dot^2 <= epsilon^2 * |normal|^2 when the dot is negative
+    constexpr float FACING_EPSILON = std::numeric_limits<float>::epsilon();
+
+    struct Corner
+    {
+        vect8f_t x;
+        vect8f_t y;
+        vect8f_t z;
+    };
+
+    // One corner of up to 8 faces gathered from the vertex stream; lanes past the last face repeat it
+    Corner gatherCorner(const std::vector<Face>& faces, const size_t first, const size_t count,
+                        const TransformedVertexStream& vertices, int Face::*corner)
+    {
+        alignas(32) float x[BATCH_SIZE];
+        alignas(32) float y[BATCH_SIZE];
+        alignas(32) float z[BATCH_SIZE];
+        for (size_t lane = 0; lane < BATCH_SIZE; ++lane)
+        {
+            // OBJ indices start at 1
+            const auto index = static_cast<size_t>(faces[first + std::min(lane, count - 1u)].*corner - 1);
+            x[lane] = vertices.x[index];
+            y[lane] = vertices.y[index];
+            z[lane] = vertices.z[index];
+        }
+        return {vect8f_t::load(x), vect8f_t::load(y), vect8f_t::load(z)};
+    }
+
+    // Lanes whose face points towards the camera at the origin, without normalizing anything
+    uint32_t frontFacing(const Corner& a, const Corner& b, const Corner& c)
+    {
+        const vect8f_t abX = b.x - a.x;
+        const vect8f_t abY = b.y - a.y;
+        const vect8f_t abZ = b.z - a.z;
+        const vect8f_t acX = c.x - a.x;
+        const vect8f_t acY = c.y - a.y;
+        const vect8f_t acZ = c.z - a.z;
+
+        const vect8f_t normalX = abY * acZ - abZ * acY;
+        const vect8f_t normalY = abZ * acX - abX * acZ;
+        const vect8f_t normalZ = abX * acY - abY * acX;
+
+        const vect8f_t zero = vect8f_t::splat(0.0f);
+        const vect8f_t cameraX = zero - a.x;
+        const vect8f_t cameraY = zero - a.y;
+        const vect8f_t cameraZ = zero - a.z;
+
+        const vect8f_t facing = normalX * cameraX + normalY * cameraY + normalZ * cameraZ;
+        const vect8f_t normalSquared = normalX * normalX + normalY * normalY + normalZ * normalZ;
+        const vect8f_t toleranceSquared = normalSquared * vect8f_t::splat(FACING_EPSILON * FACING_EPSILON);
+
+        // A degenerate face has no normal to face the camera with and is culled, as the normalized test did
+        const uint32_t hasNormal = zero.lessThan(normalSquared);
+        return hasNormal & (zero.lessEqual(facing) | (facing * facing).lessEqual(toleranceSquared));
+    }
+
+    // Lanes whose corner is outside the plane, by the clipper's signed distance (p - point) . normal
+    uint32_t outsidePlane(const Corner& corner, const Plane& plane)
+    {
+        const vect8f_t distance = (corner.x - vect8f_t::splat(plane.point.x)) * vect8f_t::splat(plane.norm.x)
+                                + (corner.y - vect8f_t::splat(plane.point.y)) * vect8f_t::splat(plane.norm.y)
+                                + (corner.z - vect8f_t::splat(plane.point.z)) * vect8f_t::splat(plane.norm.z);
+
+        // Not inside rather than below, so a NaN distance counts as outside the way it does in the clipper
+        return ~vect8f_t::splat(-CLIPPING_EPSILON).lessEqual(distance) & ALL_LANES;
+    }
+}
+
+namespace Culling
+{
+
+void cullFaces(const std::vector<Face>& faces, const TransformedVertexStream& viewVertices,
+               const std::span<const Plane> planes, const bool isBackFaceCullingEnabled,
+               std::vector<VisibleFace>& visible)
+{
+    visible.clear();
+
+    for (size_t first = 0; first < faces.size(); first += BATCH_SIZE)
+    {
+        const size_t count = std::min(BATCH_SIZE, faces.size() - first);
+        const Corner a = gatherCorner(faces, first, count, viewVertices, &Face::a);
+        const Corner b = gatherCorner(faces, first, count, viewVertices, &Face::b);
+        const Corner c = gatherCorner(faces, first, count, viewVertices, &Face::c);
+
+        uint32_t survivors = ALL_LANES >> (BATCH_SIZE - count);
+        if (isBackFaceCullingEnabled)
+        {
+            survivors &= frontFacing(a, b, c);
+        }
+
+        // Outcodes: all corners outside one plane rejects the face, any corner outside some plane needs clipping
+        uint32_t outsideAll{0};
+        uint32_t outsideAny{0};
+        for (const auto& plane : planes)
+        {
+            const uint32_t outsideA = outsidePlane(a, plane);
+            const uint32_t outsideB = outsidePlane(b, plane);
+            const uint32_t outsideC = outsidePlane(c, plane);
+            outsideAll |= outsideA & outsideB & outsideC;
+            outsideAny |= outsideA | outsideB | outsideC;
+        }
+        survivors &= ~outsideAll;
+
+        while (survivors != 0u)
+        {
+            const auto lane = static_cast<uint32_t>(std::countr_zero(survivors));
+            visible.push_back({static_cast<uint32_t>(first) + lane, ((outsideAny >> lane) & 1u) != 0u});
+            survivors &= survivors - 1u;
+        }
+    }
+}
+
+}
@@ -0,0 +1,294 @@
+#include "graphics/culling/inc/OcclusionCuller.h"
+
+#include "graphics/shapes/inc/Mesh.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    constexpr float DEGENERATE_AREA = 1e-6f;
+
+    constexpr uint8_t COVERED = 1u;
+    constexpr uint8_t ON_SILHOUETTE = 2u;
+
+    // Edge function: positive on the inner side for a counter-clockwise triangle in screen space
+    float edge(const float x0, const float y0, const float x1, const float y1, const float px, const float py)
+    {
+        return (x1 - x0) * (py - y0) - (y1 - y0) * (px - x0);
+    }
+
+    // How far the edge function can move from a pixel's centre to one of its corners
+    float halfPixelReach(const float x0, const float y0, const float x1, const float y1)
+    {
+        return 0.5f * (std::abs(x1 - x0) + std::abs(y1 - y0));
+    }
+
+    // Same facing rule as the face culler: the unnormalized normal against the vector to the camera at the origin
+    bool isFacingCamera(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c)
+    {
+        const float abX = b.x - a.x;
+        const float abY = b.y - a.y;
+        const float abZ = b.z - a.z;
+        const float acX = c.x - a.x;
+        const float acY = c.y - a.y;
+        const float acZ = c.z - a.z;
+
+        const float normalX = abY * acZ - abZ * acY;
+        const float normalY = abZ * acX - abX * acZ;
+        const float normalZ = abX * acY - abY * acX;
+        return -(normalX * a.x + normalY * a.y + normalZ * a.z) > 0.0f;
+    }
+}
+
+namespace Culling
+{
+
+OcclusionCuller::OcclusionCuller(const size_t width, const size_t height)
+    : _width(width)
+    , _height(height)
+    , _occluderDepth(width * height, std::numeric_limits<float>::infinity())
+    , _meshCoverage(width * height, 0u)
+    , _meshDepth(width * height, std::numeric_limits<float>::lowest())
+{
+}
+
+void OcclusionCuller::beginFrame(const glm::mat4x4& projection, const float zNear)
+{
+    _projection = projection;
+    _zNear = zNear;
+
+    std::ranges::fill(_occluderDepth, std::numeric_limits<float>::infinity());
+}
+
+OcclusionCuller::ScreenVertex OcclusionCuller::toScreen(const glm::vec4& viewPosition) const
+{
+    const glm::vec4 clip = _projection * viewPosition;
+    const float ndcX = clip.x / clip.w;
+    const float ndcY = clip.y / clip.w;
+
+    // Same viewport mapping as the main pipeline, including the flipped Y axis
+    return {
+        (ndcX * 0.5f + 0.5f) * static_cast<float>(_width),
+        (-ndcY * 0.5f + 0.5f) * static_cast<float>(_height),
+        viewPosition.z
+    };
+}
+
+OcclusionCuller::PixelRect OcclusionCuller::pixelsUnder(const float minX, const float minY, const float maxX,
+                                                        const float maxY) const
+{
+    return {
+        std::max(0, static_cast<int>(std::floor(minX))),
+        std::max(0, static_cast<int>(std::floor(minY))),
+        std::min(static_cast<int>(_width) - 1, static_cast<int>(std::floor(maxX))),
+        std::min(static_cast<int>(_height) - 1, static_cast<int>(std::floor(maxY)))
+    };
+}
+
+void OcclusionCuller::rasterizeOccluder(const Mesh& mesh, const glm::mat4x4& modelView)
+{
+    _viewVertices.resize(mesh.vertices.size());
+    _screenVertices.resize(mesh.vertices.size());
+    for (size_t i = 0; i < mesh.vertices.size(); ++i)
+    {
+        const auto& vertex = mesh.vertices[i];
+        _viewVertices[i] = modelView * glm::vec4(vertex.x, vertex.y, vertex.z, 1.0f);
+        // Only read for faces past the near plane, where w is positive
+        _screenVertices[i] = toScreen(_viewVertices[i]);
+    }
+
+    // Front faces, counted per edge: an edge with a single one of them bounds the occluder on screen.
+    // A face crossing the near plane would need clipping; leaving it out turns its neighbours' shared
+    // edges into silhouette edges, so the buffer only occludes less.
+    const bool hasEdges = mesh.edges.faceEdges.size() == mesh.faces.size();
+    _isFrontFace.assign(mesh.faces.size(), 0u);
+    _frontFacesPerEdge.assign(hasEdges ? mesh.edges.edgeCount : 0u, 0u);
+    for (size_t i = 0; i < mesh.faces.size(); ++i)
+    {
+        const auto& face = mesh.faces[i];
+        const auto& a = _viewVertices[face.a - 1];
+        const auto& b = _viewVertices[face.b - 1];
+        const auto& c = _viewVertices[face.c - 1];
+        if (a.z < _zNear || b.z < _zNear || c.z < _zNear || !isFacingCamera(a, b, c))
+        {
+            continue;
+        }
+
+        _isFrontFace[i] = 1u;
+        if (hasEdges)
+        {
+            for (const uint32_t faceEdge : mesh.edges.faceEdges[i])
+            {
+                _frontFacesPerEdge[faceEdge] = static_cast<uint8_t>(std::min(_frontFacesPerEdge[faceEdge] + 1, 2));
+            }
+        }
+    }
+
+    for (size_t i = 0; i < mesh.faces.size(); ++i)
+    {
+        if (_isFrontFace[i])
+        {
+            const auto& face = mesh.faces[i];
+            rasterizeFace(_screenVertices[face.a - 1], _screenVertices[face.b - 1], _screenVertices[face.c - 1]);
+        }
+    }
+
+    // Without edge numbers no edge is known to be shared, and every one of them counts as a silhouette
+    for (size_t i = 0; i < mesh.faces.size(); ++i)
+    {
+        if (!_isFrontFace[i])
+        {
+            continue;
+        }
+
+        const auto& face = mesh.faces[i];
+        const std::array<int, 3> corners{face.a - 1, face.b - 1, face.c - 1};
+        for (size_t corner = 0; corner < corners.size(); ++corner)
+        {
+            if (!hasEdges || _frontFacesPerEdge[mesh.edges.faceEdges[i][corner]] == 1u)
+            {
+                markSilhouette(_screenVertices[corners[corner]], _screenVertices[corners[(corner + 1u) % 3u]]);
+            }
+        }
+    }
+
+    // Fold the occluder into the buffer, resetting the scratch it touched for the next one
+    for (int y = _meshRect.y0; y <= _meshRect.y1; ++y)
+    {
+        for (int x = _meshRect.x0; x <= _meshRect.x1; ++x)
+        {
+            const size_t index = static_cast<size_t>(y) * _width + static_cast<size_t>(x);
+            if (_meshCoverage[index] == COVERED)
+            {
+                _occluderDepth[index] = std::min(_occluderDepth[index], _meshDepth[index]);
+            }
+            _meshCoverage[index] = 0u;
+            _meshDepth[index] = std::numeric_limits<float>::lowest();
+        }
+    }
+    _meshRect = {};
+}
+
+void OcclusionCuller::rasterizeFace(const ScreenVertex& a, ScreenVertex b, ScreenVertex c)
+{
+    const float area = edge(a.x, a.y, b.x, b.y, c.x, c.y);
+    if (std::abs(area) < DEGENERATE_AREA)
+    {
+        return;
+    }
+    if (area < 0.0f)
+    {
+        std::swap(b, c);
+    }
+
+    const PixelRect rect = pixelsUnder(std::min({a.x, b.x, c.x}), std::min({a.y, b.y, c.y}),
+                                       std::max({a.x, b.x, c.x}), std::max({a.y, b.y, c.y}));
+    if (rect.x0 > rect.x1 || rect.y0 > rect.y1)
+    {
+        return;
+    }
+    _meshRect = _meshRect.x0 > _meshRect.x1
+              ? rect
+              : PixelRect{std::min(_meshRect.x0, rect.x0), std::min(_meshRect.y0, rect.y0),
+                          std::max(_meshRect.x1, rect.x1), std::max(_meshRect.y1, rect.y1)};
+
+    // Conservative: the whole face occludes at its farthest point
+    const float faceDepth = std::max({a.viewZ, b.viewZ, c.viewZ});
+    const float reachAB = halfPixelReach(a.x, a.y, b.x, b.y);
+    const float reachBC = halfPixelReach(b.x, b.y, c.x, c.y);
+    const float reachCA = halfPixelReach(c.x, c.y, a.x, a.y);
+
+    for (int y = rect.y0; y <= rect.y1; ++y)
+    {
+        const float centreY = static_cast<float>(y) + 0.5f;
+        for (int x = rect.x0; x <= rect.x1; ++x)
+        {
+            const float centreX = static_cast<float>(x) + 0.5f;
+            const float edgeAB = edge(a.x, a.y, b.x, b.y, centreX, centreY);
+            const float edgeBC = edge(b.x, b.y, c.x, c.y, centreX, centreY);
+            const float edgeCA = edge(c.x, c.y, a.x, a.y, centreX, centreY);
+
+            // Any part of the pixel inside the face: the face's depth bounds that part
+            if (edgeAB + reachAB < 0.0f || edgeBC + reachBC < 0.0f || edgeCA + reachCA < 0.0f)
+            {
+                continue;
+            }
+
+            const size_t index = static_cast<size_t>(y) * _width + static_cast<size_t>(x);
+            _meshDepth[index] = std::max(_meshDepth[index], faceDepth);
+            if (edgeAB >= 0.0f && edgeBC >= 0.0f && edgeCA >= 0.0f)
+            {
+                _meshCoverage[index] |= COVERED;
+            }
+        }
+    }
+}
+
+void OcclusionCuller::markSilhouette(const ScreenVertex& from, const ScreenVertex& to)
+{
+    // Faces are rasterized first, so the rectangle of the occluder already holds every edge
+    const PixelRect rect = pixelsUnder(std::min(from.x, to.x), std::min(from.y, to.y),
+                                       std::max(from.x, to.x), std::max(from.y, to.y));
+    const float reach = halfPixelReach(from.x, from.y, to.x, to.y);
+
+    // Within the segment's bounds, a pixel is crossed when the line passes between its corners
+    for (int y = rect.y0; y <= rect.y1; ++y)
+    {
+        const float centreY = static_cast<float>(y) + 0.5f;
+        for (int x = rect.x0; x <= rect.x1; ++x)
+        {
+            const float centreX = static_cast<float>(x) + 0.5f;
+            if (std::abs(edge(from.x, from.y, to.x, to.y, centreX, centreY)) <= reach)
+            {
+                _meshCoverage[static_cast<size_t>(y) * _width + static_cast<size_t>(x)] |= ON_SILHOUETTE;
+            }
+        }
+    }
+}
+
+bool OcclusionCuller::isVisible(const BoundingBox& bounds, const glm::mat4x4& modelView) const
+{
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+    float nearestZ = std::numeric_limits<float>::max();
+
+    for (const auto& corner : bounds.corners())
+    {
+        const glm::vec4 viewCorner = modelView * glm::vec4(corner.x, corner.y, corner.z, 1.0f);
+
+        // A box reaching the near plane cannot be bounded on screen
+        if (viewCorner.z < _zNear)
+        {
+            return true;
+        }
+
+        const auto screenCorner = toScreen(viewCorner);
+        minX = std::min(minX, screenCorner.x);
+        minY = std::min(minY, screenCorner.y);
+        maxX = std::max(maxX, screenCorner.x);
+        maxY = std::max(maxY, screenCorner.y);
+        nearestZ = std::min(nearestZ, screenCorner.viewZ);
+    }
+
+    const PixelRect rect = pixelsUnder(minX, minY, maxX, maxY);
+    for (int y = rect.y0; y <= rect.y1; ++y)
+    {
+        const float* row = _occluderDepth.data() + static_cast<size_t>(y) * _width;
+        for (int x = rect.x0; x <= rect.x1; ++x)
+        {
+            if (row[x] > nearestZ)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+}
@@ -0,0 +1,47 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <graphics/culling/inc/BoundsCuller.h>
+#include <graphics/shapes/inc/Mesh.h>
+
+#include "doctest/doctest.h"
+
+#include <numbers>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace
+{
+    constexpr float FOV = std::numbers::pi_v<float> / 2.0f;
+
+    glm::mat4x4 placedAt(const float x, const float y, const float z)
+    {
+        return glm::translate(glm::mat4x4{1.0f}, {x, y, z});
+    }
+}
+
+TEST_CASE("The bounding sphere holds every vertex")
+{
+    const Mesh cube = makeMesh({cubeMeshVert.begin(), cubeMeshVert.end()}, {cubeMeshFaces.begin(), cubeMeshFaces.end()});
+    CHECK(cube.sphere.center.x == doctest::Approx(0.0f));
+    CHECK(cube.sphere.radius == doctest::Approx(std::numbers::sqrt3_v<float>));
+}
+
+TEST_CASE("Meshes are classified against the frustum by their bounding volumes")
+{
+    const Frustum frustum{FOV, FOV, 0.1f, 100.0f};
+    const Mesh cube = makeMesh({cubeMeshVert.begin(), cubeMeshVert.end()}, {cubeMeshFaces.begin(), cubeMeshFaces.end()});
+
+    CHECK(Culling::classifyMesh(cube, placedAt(0.0f, 0.0f, 5.0f), frustum.getPlanes()) == Culling::Containment::INSIDE);
+    CHECK(Culling::classifyMesh(cube, placedAt(0.0f, 0.0f, -5.0f), frustum.getPlanes()) == Culling::Containment::OUTSIDE);
+    CHECK(Culling::classifyMesh(cube, placedAt(0.0f, 0.0f, 150.0f), frustum.getPlanes()) == Culling::Containment::OUTSIDE);
+    // Across the left plane x = -z
+    CHECK(Culling::classifyMesh(cube, placedAt(-5.0f, 0.0f, 5.0f), frustum.getPlanes())
+          == Culling::Containment::INTERSECTING);
+    // Scale grows the sphere with the mesh: ten times larger, the same cube reaches past the near plane
+    CHECK(Culling::classifyMesh(cube, glm::scale(placedAt(0.0f, 0.0f, 5.0f), glm::vec3{10.0f}), frustum.getPlanes())
+          == Culling::Containment::INTERSECTING);
+
+    // A long thin bar just above the top plane y = z: its sphere reaches into the frustum, its box does not
+    const Mesh bar = makeMesh({{-4.0f, -0.1f, -0.1f}, {4.0f, 0.1f, 0.1f}, {4.0f, -0.1f, 0.1f}}, {{.a = 1, .b = 2, .c = 3}});
+    CHECK(Culling::classifyMesh(bar, placedAt(0.0f, 5.5f, 5.0f), frustum.getPlanes()) == Culling::Containment::OUTSIDE);
+}
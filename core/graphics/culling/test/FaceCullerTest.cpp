@@ -0,0 +1,121 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <graphics/culling/inc/FaceCuller.h>
+#include <graphics/shapes/inc/Triangle.h>
+#include <graphics/shapes/inc/VertexStream.h>
+
+#include "doctest/doctest.h"
+
+#include <numbers>
+#include <vector>
+
+namespace
+{
+    constexpr float FOV = std::numbers::pi_v<float> / 2.0f;
+
+    // View-space triangles laid out as consecutive vertex triples, w = 1
+    TransformedVertexStream makeVertices(const std::vector<vect3_t<float>>& positions)
+    {
+        TransformedVertexStream stream;
+        stream.count = positions.size();
+        for (const auto& position : positions)
+        {
+            stream.x.push_back(position.x);
+            stream.y.push_back(position.y);
+            stream.z.push_back(position.z);
+            stream.w.push_back(1.0f);
+        }
+        return stream;
+    }
+
+    std::vector<Face> makeFaces(const size_t count)
+    {
+        std::vector<Face> faces(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const int first = static_cast<int>(i * 3u) + 1;
+            faces[i] = {.a = first, .b = first + 1, .c = first + 2};
+        }
+        return faces;
+    }
+}
+
+TEST_CASE("Faces are classified by facing and frustum outcodes")
+{
+    const Frustum frustum{FOV, FOV, 0.1f, 100.0f};
+
+    // Same winding as the meshes: clockwise seen from the camera faces it
+    const auto vertices = makeVertices({
+        {-1.0f, -1.0f, 5.0f}, {0.0f, 1.0f, 5.0f}, {1.0f, -1.0f, 5.0f},      // 0: inside, facing the camera
+        {-1.0f, -1.0f, 5.0f}, {1.0f, -1.0f, 5.0f}, {0.0f, 1.0f, 5.0f},      // 1: inside, facing away
+        {-1.0f, -1.0f, -5.0f}, {0.0f, 1.0f, -5.0f}, {1.0f, -1.0f, -5.0f},   // 2: behind the camera
+        {-1.0f, -1.0f, 0.05f}, {0.0f, 1.0f, 5.0f}, {1.0f, -1.0f, 5.0f},     // 3: crosses the near plane
+        {-1.0f, -1.0f, 5.0f}, {-1.0f, -1.0f, 5.0f}, {1.0f, -1.0f, 5.0f},    // 4: degenerate
+    });
+    const auto faces = makeFaces(5u);
+
+    std::vector<Culling::VisibleFace> visible;
+
+    SUBCASE("With back-face culling")
+    {
+        Culling::cullFaces(faces, vertices, frustum.getPlanes(), true, visible);
+        REQUIRE(visible.size() == 2u);
+        CHECK(visible[0].index == 0u);
+        CHECK_FALSE(visible[0].needsClip);
+        CHECK(visible[1].index == 3u);
+        CHECK(visible[1].needsClip);
+    }
+
+    SUBCASE("Without back-face culling only the frustum rejects")
+    {
+        Culling::cullFaces(faces, vertices, frustum.getPlanes(), false, visible);
+        REQUIRE(visible.size() == 4u);
+        CHECK(visible[0].index == 0u);
+        CHECK(visible[1].index == 1u);
+        CHECK(visible[2].index == 3u);
+        CHECK(visible[3].index == 4u);
+    }
+}
+
+TEST_CASE("Faces of a mesh inside the frustum skip the plane tests")
+{
+    const auto vertices = makeVertices({
+        {-1.0f, -1.0f, 5.0f}, {0.0f, 1.0f, 5.0f}, {1.0f, -1.0f, 5.0f},      // 0: facing the camera
+        {-1.0f, -1.0f, 6.0f}, {1.0f, -1.0f, 6.0f}, {0.0f, 1.0f, 6.0f},      // 1: facing away
+    });
+    const auto faces = makeFaces(2u);
+
+    std::vector<Culling::VisibleFace> visible;
+    Culling::cullFaces(faces, vertices, {}, false, visible);
+    REQUIRE(visible.size() == 2u);
+    CHECK_FALSE(visible[0].needsClip);
+    CHECK_FALSE(visible[1].needsClip);
+
+    // Facing is still tested
+    Culling::cullFaces(faces, vertices, {}, true, visible);
+    REQUIRE(visible.size() == 1u);
+    CHECK(visible[0].index == 0u);
+    CHECK_FALSE(visible[0].needsClip);
+}
+
+TEST_CASE("Batches past the first 8 faces keep their order and skip the padding lanes")
+{
+    const Frustum frustum{FOV, FOV, 0.1f, 100.0f};
+
+    std::vector<vect3_t<float>> positions;
+    for (int i = 0; i < 11; ++i)
+    {
+        const auto z = 5.0f + static_cast<float>(i);
+        positions.insert(positions.end(), {{-1.0f, -1.0f, z}, {0.0f, 1.0f, z}, {1.0f, -1.0f, z}});
+    }
+    const auto faces = makeFaces(11u);
+
+    std::vector<Culling::VisibleFace> visible;
+    Culling::cullFaces(faces, makeVertices(positions), frustum.getPlanes(), true, visible);
+
+    REQUIRE(visible.size() == 11u);
+    for (uint32_t i = 0; i < visible.size(); ++i)
+    {
+        CHECK(visible[i].index == i);
+    }
+}
@@ -0,0 +1,68 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <graphics/culling/inc/OcclusionCuller.h>
+#include <graphics/shapes/inc/Mesh.h>
+#include <utils/inc/ProjectionMat.h>
+
+#include "doctest/doctest.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace
+{
+    constexpr float Z_NEAR = 0.1f;
+
+    glm::mat4x4 placedAt(const float x, const float y, const float z)
+    {
+        return glm::translate(glm::mat4x4{1.0f}, {x, y, z});
+    }
+
+    // Square wall facing the camera, split along its diagonal into two triangles
+    Mesh makeWall(const float left, const float right, const float halfHeight)
+    {
+        return makeMesh({{left, -halfHeight, 0.0f}, {left, halfHeight, 0.0f}, {right, halfHeight, 0.0f}, {right, -halfHeight, 0.0f}},
+                        {{.a = 1, .b = 2, .c = 3}, {.a = 1, .b = 3, .c = 4}});
+    }
+
+    Culling::OcclusionCuller makeCuller()
+    {
+        Culling::OcclusionCuller culler;
+        culler.beginFrame(Utils::makePerspectiveMat4(1.0471976f, 16.0f / 9.0f, Z_NEAR, 100.0f), Z_NEAR);
+        return culler;
+    }
+
+    constexpr BoundingBox UNIT_BOX{{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}};
+}
+
+TEST_CASE("An occluder hides what is behind it and nothing in front of it")
+{
+    Culling::OcclusionCuller culler = makeCuller();
+    culler.rasterizeOccluder(makeWall(-3.0f, 3.0f, 3.0f), placedAt(0.0f, 0.0f, 5.0f));
+
+    // Straight behind the wall, across the diagonal both of its triangles share
+    CHECK_FALSE(culler.isVisible(UNIT_BOX, placedAt(0.0f, 0.0f, 10.0f)));
+    CHECK_FALSE(culler.isVisible(UNIT_BOX, placedAt(-2.0f, 2.0f, 12.0f)));
+
+    // In front of the wall, partly past its edge, or reaching through it
+    CHECK(culler.isVisible(UNIT_BOX, placedAt(0.0f, 0.0f, 3.0f)));
+    CHECK(culler.isVisible(UNIT_BOX, placedAt(6.0f, 0.0f, 10.0f)));
+    CHECK(culler.isVisible(UNIT_BOX, placedAt(0.0f, 0.0f, 5.2f)));
+
+    // Turned away from the camera, the wall occludes nothing
+    Culling::OcclusionCuller turned = makeCuller();
+    turned.rasterizeOccluder(makeWall(-3.0f, 3.0f, 3.0f), glm::rotate(placedAt(0.0f, 0.0f, 5.0f), 3.1415927f,
+                                                                      glm::vec3{0.0f, 1.0f, 0.0f}));
+    CHECK(turned.isVisible(UNIT_BOX, placedAt(0.0f, 0.0f, 10.0f)));
+}
+
+TEST_CASE("Separate occluders leave the pixels along their common edge uncovered")
+{
+    Culling::OcclusionCuller culler = makeCuller();
+    culler.rasterizeOccluder(makeWall(-3.0f, 0.0f, 3.0f), placedAt(0.0f, 0.0f, 5.0f));
+    culler.rasterizeOccluder(makeWall(0.0f, 3.0f, 3.0f), placedAt(0.0f, 0.0f, 5.0f));
+
+    // Each wall hides what is behind it alone, but neither knows the other closes the gap between them
+    CHECK_FALSE(culler.isVisible(UNIT_BOX, placedAt(-1.5f, 0.0f, 10.0f)));
+    CHECK_FALSE(culler.isVisible(UNIT_BOX, placedAt(1.5f, 0.0f, 10.0f)));
+    CHECK(culler.isVisible(UNIT_BOX, placedAt(0.0f, 0.0f, 10.0f)));
+}
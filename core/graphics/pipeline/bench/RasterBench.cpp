@@ -0,0 +1,124 @@
+#include <graphics/pipeline/inc/GeometryStage.h>
+#include <graphics/pipeline/inc/RasterStage.h>
+#include <graphics/rendering/inc/RenderTarget.h>
+#include <graphics/scene/inc/Scene.h>
+#include <graphics/shapes/inc/Mesh.h>
+#include <graphics/textures/inc/Textures.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Times the raster stage alone in every rendering state: the geometry of one frame is built once per state
+// and then rasterized over and over, so the numbers are the cost of the specialized triangle loops.
+//
+// Usage: RasterBench [asset] [frames]   defaults to the drone and 200 frames at 1920x1080
+namespace
+{
+    constexpr size_t WIDTH = 1920u;
+    constexpr size_t HEIGHT = 1080u;
+    constexpr float FOV_Y = 1.0471976f;
+    constexpr float Z_NEAR = 0.1f;
+    constexpr float Z_FAR = 100.0f;
+
+    struct State
+    {
+        const char* name;
+        Render::RenderingStates state;
+    };
+
+    constexpr std::array<State, 7> STATES{{
+        {"WIREFRAME_WITH_VERTICES", Render::RenderingStates::WIREFRAME_WITH_VERTICES},
+        {"WIREFRAME_ONLY", Render::RenderingStates::WIREFRAME_ONLY},
+        {"FILLED_TRIANGLES", Render::RenderingStates::FILLED_TRIANGLES},
+        {"FILLED_TRIANGLES_WITH_WIREFRAME", Render::RenderingStates::FILLED_TRIANGLES_WITH_WIREFRAME},
+        {"TEXTURED_TRIANGLES", Render::RenderingStates::TEXTURED_TRIANGLES},
+        {"TEXTURED_TRIANGLES_WITH_WIREFRAME", Render::RenderingStates::TEXTURED_TRIANGLES_WITH_WIREFRAME},
+        {"ANTIALIASED_WIREFRAME", Render::RenderingStates::ANTIALIASED_WIREFRAME},
+    }};
+
+    // Same framing as the golden images: centered model, bounding sphere filling the view at a slight angle
+    Camera makeCamera(const Mesh& mesh)
+    {
+        const auto extent = mesh.bounds.max - mesh.bounds.min;
+        const float radius = 0.5f * std::sqrt(extent.x * extent.x + extent.y * extent.y + extent.z * extent.z);
+        const float distance = 1.1f * radius / std::sin(FOV_Y / 2.0f);
+
+        Camera camera;
+        camera._position = {-0.5f * distance, 0.3f * distance, -0.8f * distance};
+        camera._direction = (vect3_t<float>{0.0f, 0.0f, 0.0f} - camera._position).normalize();
+        return camera;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    const std::string assetName = argc > 1 ? argv[1] : "drone";
+    const size_t frames = argc > 2 ? std::max(1, std::stoi(argv[2])) : 200u;
+
+    const std::filesystem::path assets{ASSETS_DIR};
+    std::vector<vect3_t<float>> vertices;
+    std::vector<Face> faces;
+    LoadOBJFileSimplified(assets / (assetName + ".obj"), vertices, faces);
+    if (faces.empty())
+    {
+        std::fprintf(stderr, "No faces loaded from %s.obj\n", assetName.c_str());
+        return 1;
+    }
+
+    Scene scene;
+    const MeshId meshId = scene.addMesh(makeMesh(std::move(vertices), std::move(faces)));
+    const Mesh& mesh = scene.mesh(meshId);
+
+    TextureId texture{NO_TEXTURE};
+    const auto texturePath = assets / (assetName + ".png");
+    if (std::filesystem::exists(texturePath))
+    {
+        Texture2dArray loaded;
+        loaded.data = LoadPngToSDLExpectedFormat(texturePath.string(), loaded.width, loaded.height);
+        texture = scene.addTexture(std::move(loaded));
+    }
+    const auto center = (mesh.bounds.min + mesh.bounds.max) * 0.5f;
+    scene.addInstance(meshId, {.translation = vect3_t<float>{0.0f, 0.0f, 0.0f} - center}, texture);
+
+    Render::GeometryStage geometryStage{{FOV_Y, Z_NEAR, Z_FAR}, std::chrono::milliseconds{16}, nullptr};
+    geometryStage.setScene(&scene);
+    geometryStage.setCamera(makeCamera(mesh));
+
+    Render::RenderTarget target{WIDTH, HEIGHT, Render::DepthFormat::FLOAT, {Z_NEAR, Z_FAR}};
+    Render::FrameGeometry geometry;
+
+    std::printf("%s, %zu faces, %zux%zu, %zu frames per state\n", assetName.c_str(), mesh.faces.size(), WIDTH,
+                HEIGHT, frames);
+    std::printf("%-36s %10s %10s %10s\n", "state", "triangles", "median ms", "min ms");
+
+    for (const auto& [name, state] : STATES)
+    {
+        const Render::GeometryInput input{
+            .targetWidth = WIDTH,
+            .targetHeight = HEIGHT,
+            .aspectRatio = static_cast<float>(WIDTH) / static_cast<float>(HEIGHT),
+            .isBackFaceCullingEnabled = true,
+            .depthOrder = Render::drawOrder(state)};
+        geometryStage.process(input, geometry);
+
+        std::vector<double> runs(frames);
+        for (auto& run : runs)
+        {
+            target.clear();
+            const auto start = std::chrono::steady_clock::now();
+            Render::rasterizeFrame(geometry, state, scene.textures(), target);
+            run = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+        std::ranges::sort(runs);
+
+        std::printf("%-36s %10zu %10.3f %10.3f\n", name, geometry.triangles.size(), runs[runs.size() / 2u],
+                    runs.front());
+    }
+    return 0;
+}
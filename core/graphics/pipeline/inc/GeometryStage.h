@@ -0,0 +1,127 @@
+#ifndef GEOMETRYSTAGE_H
+#define GEOMETRYSTAGE_H
+
+#include "common/inc/Vect4f.hpp"
+#include "common/inc/Vectors.hpp"
+#include "graphics/camera/inc/Camera.h"
+#include "graphics/clipping/inc/Clipping.h"
+#include "graphics/culling/inc/BoundsCuller.h"
+#include "graphics/culling/inc/FaceCuller.h"
+#include "graphics/culling/inc/OcclusionCuller.h"
+#include "graphics/rendering/inc/DepthOrdering.h"
+#include "graphics/scene/inc/Scene.h"
+#include "graphics/shapes/inc/Triangle.h"
+#include "graphics/shapes/inc/VertexStream.h"
+#include "utils/inc/FrameScheduler.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "glm/mat4x4.hpp"
+
+struct Mesh;
+
+namespace Utils
+{
+class ThreadPool;
+}
+
+namespace Render
+{
+
+struct ProjectionSettings
+{
+    float fovY{0.0f};
+    float zNear{0.1f};
+    float zFar{100.0f};
+};
+
+// Movement requested by input, applied on every simulation step of the camera
+struct CameraControls
+{
+    vect3_t<float> velocity{0.0f, 0.0f, 0.0f};
+    float yaw{0.0f};
+    float pitch{0.0f};
+};
+
+// Everything the geometry stage reads from the main thread, copied once per frame so the stage
+// can run on another thread while the main thread handles input for the next frame
+struct GeometryInput
+{
+    std::chrono::nanoseconds frameTime{0};
+    CameraControls cameraControls{};
+    size_t targetWidth{0};
+    size_t targetHeight{0};
+    float aspectRatio{1.0f};
+    bool isBackFaceCullingEnabled{false};
+    DepthOrder depthOrder{DepthOrder::BACK_TO_FRONT};
+};
+
+// Screen-space triangles of one frame and the order to rasterize them in
+struct FrameGeometry
+{
+    std::vector<Triangle> triangles;
+    TriangleSorter sorter;
+};
+
+// Camera simulation, occlusion culling, transform, back-face culling, clipping, projection and depth
+// ordering: everything before rasterization. Every instance of the scene goes through it in one pass into
+// one list of triangles. It owns all of its state, so it can run on its own thread.
+class GeometryStage
+{
+public:
+    GeometryStage(ProjectionSettings projection, std::chrono::nanoseconds simulationStep, Utils::ThreadPool* threadPool);
+
+    // The scene must outlive the stage and not change while a frame is processed
+    void setScene(const Scene* scene) { _scene = scene; }
+
+    // Places the camera without interpolating from where it was, e.g. for fixed poses in tests
+    void setCamera(const Camera& camera)
+    {
+        _camera = camera;
+        _previousCamera = camera;
+    }
+
+    void process(const GeometryInput& input, FrameGeometry& output);
+
+private:
+    void updateProjection(float aspectRatio);
+    void processInstances(const glm::mat4x4& view, const GeometryInput& input, std::vector<Triangle>& triangles);
+    // isInside: the whole mesh is known to be in the frustum, its faces skip the plane tests and clipping
+    void processMeshFaces(const Mesh& mesh, TextureId texture, const glm::mat4x4& modelView, bool isInside,
+                          const GeometryInput& input, std::vector<Triangle>& triangles);
+    void beginEdgeClaims(const Mesh& mesh);
+    // Wireframe edges of the face no visible face of the mesh has drawn yet this frame, as a Triangle edge mask
+    uint8_t claimEdges(const Mesh& mesh, uint32_t faceIndex);
+
+    ProjectionSettings _projectionSettings;
+    float _aspectRatio{0.0f};
+    glm::mat4x4 _projection{0.0f};
+    mat4f_t _projectionColumns{};
+    std::optional<Frustum> _frustum;
+
+    Camera _camera;
+    Camera _previousCamera;
+    // The camera is simulated at a fixed rate whatever the frame rate, and interpolated for display
+    Utils::FixedTimestep _simulationClock;
+
+    // Model-view matrix of every instance, streamed from the scene's packed world matrices at the start of a frame
+    std::vector<glm::mat4x4> _modelViews;
+    // View-space positions of the instance being processed, reused for every instance and frame
+    TransformedVertexStream _viewVertices;
+    std::vector<Culling::VisibleFace> _visibleFaces;
+    // Per edge of the mesh being processed, the stamp of the last instance that drew it
+    std::vector<uint32_t> _edgeStamps;
+    uint32_t _edgeStamp{0};
+
+    Culling::OcclusionCuller _occlusionCuller;
+    const Scene* _scene{nullptr};
+    Utils::ThreadPool* _threadPool;
+};
+
+}
+
+#endif //GEOMETRYSTAGE_H
@@ -0,0 +1,89 @@
+#ifndef RASTERSTAGE_H
+#define RASTERSTAGE_H
+
+#include "graphics/rendering/inc/DepthOrdering.h"
+
+#include <cstdint>
+#include <span>
+
+struct Texture2dArray;
+
+namespace Render
+{
+
+struct FrameGeometry;
+class RenderTarget;
+
+enum class RenderingStates : uint8_t
+{
+    WIREFRAME_WITH_VERTICES = 1U,           // Displays a wireframe with small red dots at each triangle vertex
+    WIREFRAME_ONLY,                        // Displays only the wireframe lines
+    FILLED_TRIANGLES,                     // Displays filled triangles with a solid color
+    FILLED_TRIANGLES_WITH_WIREFRAME,     // Displays both filled triangles and wireframe lines
+    TEXTURED_TRIANGLES,                 // Displays textured triangles
+    TEXTURED_TRIANGLES_WITH_WIREFRAME, // Displays both textured triangles and wireframe lines
+    ANTIALIASED_WIREFRAME,            // Displays only the wireframe lines, anti-aliased
+};
+
+// What the raster stage draws for a state. Used as a template argument, so each state gets a triangle loop
+// of its own with only its draws in it, and the state is looked at once per frame rather than per triangle.
+struct RasterFeatures
+{
+    bool vertices{false};   // A small red dot at each corner
+    bool flat{false};       // Solid color fill, tested against the z-buffer
+    bool textured{false};   // Perspective correct texture fill, tested against the z-buffer
+    bool wireframe{false};  // White edges, each drawn once, hidden by the fill in front of them
+    bool antialiased{false}; // Wu lines blended by coverage for the wireframe; a wireframe over fills stays aliased
+};
+
+[[nodiscard]] constexpr RasterFeatures rasterFeatures(const RenderingStates state)
+{
+    switch (state)
+    {
+    case RenderingStates::WIREFRAME_WITH_VERTICES:
+        return {.vertices = true, .wireframe = true};
+    case RenderingStates::WIREFRAME_ONLY:
+        return {.wireframe = true};
+    case RenderingStates::FILLED_TRIANGLES:
+        return {.flat = true};
+    case RenderingStates::FILLED_TRIANGLES_WITH_WIREFRAME:
+        return {.flat = true, .wireframe = true};
+    case RenderingStates::TEXTURED_TRIANGLES:
+        return {.textured = true};
+    case RenderingStates::TEXTURED_TRIANGLES_WITH_WIREFRAME:
+        return {.textured = true, .wireframe = true};
+    case RenderingStates::ANTIALIASED_WIREFRAME:
+        return {.wireframe = true, .antialiased = true};
+    }
+    return {};
+}
+
+// Filled triangles test against the z-buffer and are best drawn front to back; a wireframe over them is
+// drawn after all of them and depth tested too, so their order does not matter to it
+[[nodiscard]] constexpr bool isDepthTestedState(const RenderingStates state)
+{
+    const RasterFeatures features = rasterFeatures(state);
+    return features.flat || features.textured;
+}
+
+// Order the geometry stage sorts the triangles in for the fills, the only pass that walks it: nearest first
+// where the z-buffer rejects what is hidden, painter's order when early-Z ordering is off. States without
+// fills are not sorted. Their lines are one color, so even the anti-aliased ones blend the same in any order.
+[[nodiscard]] constexpr DepthOrder drawOrder(const RenderingStates state, const bool isEarlyZOrderingEnabled = true)
+{
+    if (!isDepthTestedState(state))
+    {
+        return DepthOrder::NONE;
+    }
+    return isEarlyZOrderingEnabled ? DepthOrder::FRONT_TO_BACK : DepthOrder::BACK_TO_FRONT;
+}
+
+// Draws the triangles of one frame into the render target in their draw order, textured triangles with
+// the texture their index picks out of textures. The target is neither cleared nor resolved here, that
+// belongs to whoever presents it.
+void rasterizeFrame(const FrameGeometry& geometry, RenderingStates renderingState,
+                    std::span<const Texture2dArray> textures, RenderTarget& renderTarget);
+
+}
+
+#endif //RASTERSTAGE_H
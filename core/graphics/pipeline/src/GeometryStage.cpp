@@ -0,0 +1,252 @@
+#include "graphics/pipeline/inc/GeometryStage.h"
+
+#include "common/inc/Colors.h"
+#include "graphics/light/inc/light.h"
+#include "graphics/shapes/inc/Mesh.h"
+#include "utils/inc/ProjectionMat.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <span>
+
+namespace
+{
+    enum VertexPoint : size_t
+    {
+        A,
+        B,
+        C
+    };
+}
+
+namespace Render
+{
+
+GeometryStage::GeometryStage(const ProjectionSettings projection, const std::chrono::nanoseconds simulationStep,
+                             Utils::ThreadPool* threadPool)
+    : _projectionSettings(projection)
+    , _simulationClock(simulationStep)
+    , _threadPool(threadPool)
+{
+}
+
+void GeometryStage::updateProjection(const float aspectRatio)
+{
+    const auto& [fovY, zNear, zFar] = _projectionSettings;
+    const float fovX = 2.0f * std::atan(std::tan(fovY / 2.0f) * aspectRatio);
+
+    _aspectRatio = aspectRatio;
+    _projection = Utils::makePerspectiveMat4(fovY, aspectRatio, zNear, zFar);
+    _projectionColumns = mat4f_t::load(&_projection[0][0]);
+    _frustum.emplace(fovX, fovY, zNear, zFar);
+}
+
+void GeometryStage::process(const GeometryInput& input, FrameGeometry& output)
+{
+    output.triangles.clear();
+
+    if (!_frustum || input.aspectRatio != _aspectRatio)
+    {
+        updateProjection(input.aspectRatio);
+    }
+
+    _camera._velocity = input.cameraControls.velocity;
+    _camera._yaw = input.cameraControls.yaw;
+    _camera._pitch = input.cameraControls.pitch;
+
+    for (size_t step = _simulationClock.advance(input.frameTime); step > 0; --step)
+    {
+        _previousCamera = _camera;
+        _camera.updateTick(_simulationClock.stepSeconds());
+    }
+
+    //Create the view matrix
+    const Camera viewCamera = Camera::interpolate(_previousCamera, _camera, _simulationClock.alpha());
+    const auto target = viewCamera._position + viewCamera._direction;
+    glm::mat4x4 viewMat = Utils::lookAtMat(viewCamera._position, target, {0, 1, 0});
+
+    if (_scene != nullptr)
+    {
+        processInstances(viewMat, input, output.triangles);
+    }
+
+    output.sorter.sort(output.triangles, input.depthOrder, _threadPool);
+}
+
+void GeometryStage::processInstances(const glm::mat4x4& view, const GeometryInput& input,
+                                     std::vector<Triangle>& triangles)
+{
+    const auto instances = _scene->instances();
+    const auto worldMatrices = _scene->worldMatrices();
+    _modelViews.resize(worldMatrices.size());
+    std::ranges::transform(worldMatrices, _modelViews.begin(),
+                           [&view](const glm::mat4x4& world) { return view * world; });
+
+    // Occlusion pass: rasterize the big occluders at low resolution first, then skip every other instance
+    // whose bounds are fully hidden before any of its faces is transformed, clipped or rasterized
+    _occlusionCuller.beginFrame(_projection, _projectionSettings.zNear);
+    for (size_t i = 0; i < instances.size(); ++i)
+    {
+        if (instances[i].isOccluder)
+        {
+            _occlusionCuller.rasterizeOccluder(_scene->mesh(instances[i].mesh), _modelViews[i]);
+        }
+    }
+
+    // Instances of one mesh one after the other, its vertex stream and faces stay in cache between them
+    for (const auto& [meshId, texture, first, count] : _scene->batches())
+    {
+        const Mesh& mesh = _scene->mesh(meshId);
+        for (uint32_t i = first; i < first + count; ++i)
+        {
+            // Whole mesh against the frustum first, an instance out of view costs two bounding volume tests
+            const auto containment = Culling::classifyMesh(mesh, _modelViews[i], _frustum->getPlanes());
+            if (containment == Culling::Containment::OUTSIDE)
+            {
+                continue;
+            }
+
+            if (!instances[i].isOccluder && !_occlusionCuller.isVisible(mesh.bounds, _modelViews[i]))
+            {
+                continue;
+            }
+
+            processMeshFaces(mesh, texture, _modelViews[i], containment == Culling::Containment::INSIDE, input,
+                             triangles);
+        }
+    }
+}
+
+void GeometryStage::beginEdgeClaims(const Mesh& mesh)
+{
+    // A new stamp releases every edge claimed for the previous mesh without touching the array
+    if (++_edgeStamp == 0u)
+    {
+        std::ranges::fill(_edgeStamps, 0u);
+        _edgeStamp = 1u;
+    }
+
+    if (_edgeStamps.size() < mesh.edges.edgeCount)
+    {
+        _edgeStamps.resize(mesh.edges.edgeCount, 0u);
+    }
+}
+
+uint8_t GeometryStage::claimEdges(const Mesh& mesh, const uint32_t faceIndex)
+{
+    if (mesh.edges.faceEdges.size() != mesh.faces.size())
+    {
+        return 0b111;
+    }
+
+    // The first visible face with an edge draws it, any later face sharing it leaves it out
+    uint8_t edgeMask{0};
+    const auto& faceEdges = mesh.edges.faceEdges[faceIndex];
+    for (size_t edge = 0; edge < faceEdges.size(); ++edge)
+    {
+        auto& stamp = _edgeStamps[faceEdges[edge]];
+        if (stamp != _edgeStamp)
+        {
+            stamp = _edgeStamp;
+            edgeMask |= static_cast<uint8_t>(1u << edge);
+        }
+    }
+    return edgeMask;
+}
+
+void GeometryStage::processMeshFaces(const Mesh& mesh, const TextureId texture, const glm::mat4x4& modelView,
+                                     const bool isInside, const GeometryInput& input, std::vector<Triangle>& triangles)
+{
+    static auto offsetIndex = [](const int index){return index - 1;};
+    const vect4f_t lightDirection{getGlobalLight()._direction, 0.0f};
+
+    //Transform: apply world, then view, to every vertex once rather than to every corner of every face
+    transformVertexStream(mat4f_t::load(&modelView[0][0]), mesh.positions, _viewVertices);
+
+    //Culling: back faces and faces outside the frustum are dropped 8 at a time before anything else.
+    //A mesh inside the frustum has no face to drop or clip against it, only facing is tested
+    const std::span<const Plane> planes = isInside ? std::span<const Plane>{} : _frustum->getPlanes();
+    Culling::cullFaces(mesh.faces, _viewVertices, planes, input.isBackFaceCullingEnabled, _visibleFaces);
+    beginEdgeClaims(mesh);
+
+    const float halfWidth = static_cast<float>(input.targetWidth) / 2.0f;
+    const float halfHeight = static_cast<float>(input.targetHeight) / 2.0f;
+    // Flip the Y axis because the model is loaded with y up
+    const vect4f_t viewportScale{halfWidth, -halfHeight, 1.0f, 1.0f};
+    const vect4f_t viewportOffset{halfWidth, halfHeight, 0.0f, 0.0f};
+
+    auto projectTriangle = [&](const std::array<vect4f_t,3>& triangleToProject,
+                               const std::array<Texture2d,3>& uvToProject, const uint32_t color,
+                               const uint8_t edgeMask)
+    {
+        Triangle projectedTriangle;
+        projectedTriangle._color = color;
+        projectedTriangle._edgeMask = edgeMask;
+        projectedTriangle._texture = texture;
+
+        // IMPORTANT: use UVs generated by clipping (matches triangleToProject)
+        projectedTriangle.textCoord = uvToProject;
+
+        projectedTriangle.setAvgDepth(
+            (triangleToProject[0].z() + triangleToProject[1].z() + triangleToProject[2].z()) / 3.0f
+        );
+
+        std::ranges::transform(triangleToProject, projectedTriangle._points.begin(),
+            [this, &viewportScale, &viewportOffset](const vect4f_t& vert)
+            {
+                auto res = _projectionColumns.transform(vert);
+
+                // Perspective divide of x, y and z; w is kept for perspective-correct texturing
+                const float w = res.w();
+                if (w != 0)
+                {
+                    res = res / vect4f_t{w, w, w, 1.0f};
+                }
+
+                res = res * viewportScale + viewportOffset;
+                return glm::vec4(res.x(), res.y(), res.z(), res.w());
+            });
+
+        triangles.push_back(projectedTriangle);
+    };
+
+    for (const auto& [faceIndex, needsClip] : _visibleFaces) {
+        const auto& [aFaceVert, bFaceVert, cFaceVert, meshColor, a_uv,b_uv,c_uv] = mesh.faces[faceIndex];
+        const std::array<vect4f_t,3> transformedVertices{{
+            _viewVertices[offsetIndex(aFaceVert)],
+            _viewVertices[offsetIndex(bFaceVert)],
+            _viewVertices[offsetIndex(cFaceVert)]
+        }};
+
+        // Lighting keeps the exact normal, a face turned straight to the light must reach full intensity
+        const auto vectorAB =  transformedVertices[VertexPoint::B] - transformedVertices[VertexPoint::A];
+        const auto vectorAC =  transformedVertices[VertexPoint::C] - transformedVertices[VertexPoint::A];
+        const auto faceNormal = vectorAB.cross(vectorAC).normalize();
+        const uint32_t faceColor = applyIntensityToColor(meshColor, -faceNormal.dot(lightDirection));
+
+        const uint8_t edgeMask = claimEdges(mesh, faceIndex);
+
+        // Entirely inside the frustum: clipping would hand back the same triangle
+        if (!needsClip)
+        {
+            projectTriangle(transformedVertices, {{a_uv, b_uv, c_uv}}, faceColor, edgeMask);
+            continue;
+        }
+
+        Polygon polygon{transformedVertices, {{{a_uv},{b_uv},{c_uv}}}};
+        auto clippedPolygon = _frustum->ClipPolygon(polygon);
+        auto trianglesAfterClipping = clippedPolygon.polygon2Triangles();
+        auto clipedTexturesTriangles = clippedPolygon.polygon2TrianglesTex();
+
+        const size_t triCount = std::min(trianglesAfterClipping.size(), clipedTexturesTriangles.size());
+
+        // Projection to screen space. The edges of a clipped face no longer match its neighbours', it draws all of them
+        for (size_t i = 0; i < triCount; ++i)
+        {
+            projectTriangle(trianglesAfterClipping[i], clipedTexturesTriangles[i], faceColor, 0b111);
+        }
+    }
+}
+
+}
@@ -0,0 +1,181 @@
+#include "graphics/pipeline/inc/RasterStage.h"
+
+#include "common/inc/Colors.h"
+#include "graphics/pipeline/inc/GeometryStage.h"
+#include "graphics/rendering/inc/Display.h"
+#include "graphics/rendering/inc/LineRasterizer.h"
+#include "graphics/rendering/inc/RenderTarget.h"
+#include "graphics/textures/inc/Textures.h"
+
+#include <algorithm>
+#include <cmath>
+#include <variant>
+
+namespace
+{
+    // Stands in for the depth buffer of the feature sets that never touch it
+    struct NoDepthBuffer
+    {
+    };
+
+    // Texture of a triangle, empty for an index past the scene's textures so every texel is out of range
+    const Texture2dArray& textureOf(const Triangle& triangle, const std::span<const Texture2dArray> textures)
+    {
+        static const Texture2dArray noTexture;
+        return triangle._texture < textures.size() ? textures[triangle._texture] : noTexture;
+    }
+
+    Render::LineVertex toLineVertex(const glm::vec4& point)
+    {
+        return {point.x, point.y, 1.0f / point.w};
+    }
+
+    // |d(1/w)/dx| + |d(1/w)/dy| over the plane of the triangle on screen, 0 when it is seen edge-on
+    float reciprocalWSlopeOf(const Triangle& triangle)
+    {
+        const auto& [point0, point1, point2] = triangle._points;
+        const float deltaX1 = point1.x - point0.x;
+        const float deltaY1 = point1.y - point0.y;
+        const float deltaX2 = point2.x - point0.x;
+        const float deltaY2 = point2.y - point0.y;
+        const float determinant = deltaX1 * deltaY2 - deltaX2 * deltaY1;
+        if (determinant == 0.0f)
+        {
+            return 0.0f;
+        }
+
+        const float deltaW1 = 1.0f / point1.w - 1.0f / point0.w;
+        const float deltaW2 = 1.0f / point2.w - 1.0f / point0.w;
+        return (std::abs(deltaW1 * deltaY2 - deltaW2 * deltaY1) + std::abs(deltaX1 * deltaW2 - deltaX2 * deltaW1))
+             / std::abs(determinant);
+    }
+
+    // Every branch on the features is resolved at compile time, the loops hold only the draws of one state.
+    // Fills go first, the wireframe is laid over all of them and depth tested against them when there are
+    // any, and the vertex dots go on top of the lines. Only the fills walk the sorted draw order; lines and
+    // dots go in mesh order, since they are either depth tested or all one color, which blends the same in
+    // any order. States without fills are not sorted at all, see drawOrder().
+    template <Render::RasterFeatures Features, typename DepthBufferType>
+    void rasterizeTriangles(const Render::FrameGeometry& geometry, const std::span<const Texture2dArray> textures,
+                            Render::ColorBuffer& colorBuffer, [[maybe_unused]] DepthBufferType& depthBuffer)
+    {
+        const auto& [trianglesToRender, triangleSorter] = geometry;
+        constexpr bool isFilled = Features.flat || Features.textured;
+
+        if constexpr (isFilled)
+        {
+            for (const auto triangleIndex : triangleSorter.drawOrder())
+            {
+                const auto& triangle = trianglesToRender[triangleIndex];
+
+                if constexpr (Features.flat)
+                {
+                    Render::drawFlatTriangle(colorBuffer, triangle, triangle._color, depthBuffer);
+                }
+
+                if constexpr (Features.textured)
+                {
+                    Render::drawTexturedTriangle(colorBuffer, triangle, textureOf(triangle, textures), depthBuffer);
+                }
+            }
+        }
+
+        if constexpr (Features.wireframe)
+        {
+            for (const auto& triangle : trianglesToRender)
+            {
+                const auto& points = triangle._points;
+                const float reciprocalWSlope = isFilled ? reciprocalWSlopeOf(triangle) : 0.0f;
+                for (size_t edge = 0; edge < points.size(); ++edge)
+                {
+                    if ((triangle._edgeMask & (1u << edge)) == 0u)
+                    {
+                        continue;
+                    }
+
+                    const auto start = toLineVertex(points[edge]);
+                    const auto end = toLineVertex(points[(edge + 1u) % points.size()]);
+                    if constexpr (isFilled)
+                    {
+                        Render::drawWireLine(colorBuffer, start, end, toColorValue(Colors::WHITE), reciprocalWSlope, depthBuffer);
+                    }
+                    else if constexpr (Features.antialiased)
+                    {
+                        Render::drawWireLineAntialiased(colorBuffer, start, end, toColorValue(Colors::WHITE));
+                    }
+                    else
+                    {
+                        Render::drawWireLine(colorBuffer, start, end, toColorValue(Colors::WHITE));
+                    }
+                }
+            }
+        }
+
+        if constexpr (Features.vertices)
+        {
+            for (const auto& triangle : trianglesToRender)
+            {
+                std::ranges::for_each(triangle._points, [&colorBuffer](const auto& point)
+                {
+                    Render::drawRect(colorBuffer, point.x, point.y, 3, 3, toColorValue(Colors::RED));
+                });
+            }
+        }
+    }
+
+    template <Render::RenderingStates State>
+    void rasterizeState(const Render::FrameGeometry& geometry, const std::span<const Texture2dArray> textures,
+                        Render::RenderTarget& renderTarget)
+    {
+        constexpr Render::RasterFeatures features = Render::rasterFeatures(State);
+        auto& colorBuffer = renderTarget.color();
+
+        if constexpr (features.flat || features.textured)
+        {
+            // The depth format is picked here as well, once per frame instead of once per filled triangle or line
+            std::visit([&](auto& depthBuffer)
+            {
+                rasterizeTriangles<features>(geometry, textures, colorBuffer, depthBuffer);
+            }, renderTarget.depth());
+        }
+        else
+        {
+            NoDepthBuffer noDepthBuffer;
+            rasterizeTriangles<features>(geometry, textures, colorBuffer, noDepthBuffer);
+        }
+    }
+}
+
+namespace Render
+{
+
+void rasterizeFrame(const FrameGeometry& geometry, const RenderingStates renderingState,
+                    const std::span<const Texture2dArray> textures, RenderTarget& renderTarget)
+{
+    switch (renderingState)
+    {
+    case RenderingStates::WIREFRAME_WITH_VERTICES:
+        rasterizeState<RenderingStates::WIREFRAME_WITH_VERTICES>(geometry, textures, renderTarget);
+        break;
+    case RenderingStates::WIREFRAME_ONLY:
+        rasterizeState<RenderingStates::WIREFRAME_ONLY>(geometry, textures, renderTarget);
+        break;
+    case RenderingStates::FILLED_TRIANGLES:
+        rasterizeState<RenderingStates::FILLED_TRIANGLES>(geometry, textures, renderTarget);
+        break;
+    case RenderingStates::FILLED_TRIANGLES_WITH_WIREFRAME:
+        rasterizeState<RenderingStates::FILLED_TRIANGLES_WITH_WIREFRAME>(geometry, textures, renderTarget);
+        break;
+    case RenderingStates::TEXTURED_TRIANGLES:
+        rasterizeState<RenderingStates::TEXTURED_TRIANGLES>(geometry, textures, renderTarget);
+        break;
+    case RenderingStates::TEXTURED_TRIANGLES_WITH_WIREFRAME:
+        rasterizeState<RenderingStates::TEXTURED_TRIANGLES_WITH_WIREFRAME>(geometry, textures, renderTarget);
+        break;
+    case RenderingStates::ANTIALIASED_WIREFRAME:
+        rasterizeState<RenderingStates::ANTIALIASED_WIREFRAME>(geometry, textures, renderTarget);
+        break;
+    }
+}
+
+}
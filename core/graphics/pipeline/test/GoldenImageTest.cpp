@@ -0,0 +1,310 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <common/inc/Lodepng.h>
+#include <graphics/pipeline/inc/GeometryStage.h>
+#include <graphics/pipeline/inc/RasterStage.h>
+#include <graphics/rendering/inc/RenderTarget.h>
+#include <graphics/scene/inc/Scene.h>
+#include <graphics/shapes/inc/Mesh.h>
+#include <graphics/textures/inc/Textures.h>
+
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+
+// Renders fixed camera poses of every asset headlessly and compares them with the reference images committed
+// in GOLDEN_DIR. A missing reference fails the test; GOLDEN_UPDATE=1 records all of them from the current build
+// after an intended change of the output. Renders that differ are written to GOLDEN_OUTPUT_DIR in the build tree.
+// GOLDEN_TIMING=1 also gates the frame time of each pose against the one recorded on this machine in
+// GOLDEN_OUTPUT_DIR, recording it on the first run; wall-clock time means nothing on another machine.
+namespace
+{
+    constexpr size_t WIDTH = 480u;
+    constexpr size_t HEIGHT = 270u;
+    constexpr float FOV_Y = 1.0471976f;  // 60 degrees, as in the app
+    constexpr float Z_NEAR = 0.1f;
+    constexpr float Z_FAR = 100.0f;
+
+    // A pixel differs once a channel is off by more than this, a pose fails once too many pixels differ.
+    // Leaves room for rounding changes of SIMD or reordered math, not for a missing or misplaced triangle.
+    constexpr int CHANNEL_TOLERANCE = 16;
+    constexpr double MAX_DIFFERING_PIXELS = 0.001;
+
+    // With the timing gate on, a pose fails when its median frame time grows past recorded * ratio + slack;
+    // the slack keeps the sub-millisecond poses from tripping on timer noise
+    constexpr size_t TIMED_RUNS = 7u;
+    constexpr double TIMING_RATIO = 1.25;
+    constexpr double TIMING_SLACK_MS = 0.25;
+
+#ifdef NDEBUG
+    constexpr const char* TIMINGS_FILE = "timings_release.txt";
+#else
+    constexpr const char* TIMINGS_FILE = "timings_debug.txt";
+#endif
+
+    struct Asset
+    {
+        const char* name;
+        Render::RenderingStates state;
+    };
+
+    constexpr std::array<Asset, 7> ASSETS{{
+        {"cube", Render::RenderingStates::TEXTURED_TRIANGLES},
+        {"crab", Render::RenderingStates::TEXTURED_TRIANGLES},
+        {"drone", Render::RenderingStates::TEXTURED_TRIANGLES},
+        {"efa", Render::RenderingStates::TEXTURED_TRIANGLES},
+        {"f117", Render::RenderingStates::TEXTURED_TRIANGLES},
+        {"f22", Render::RenderingStates::TEXTURED_TRIANGLES},
+        {"sphere", Render::RenderingStates::FILLED_TRIANGLES},
+    }};
+
+    struct Pose
+    {
+        const char* name;
+        float yawDegrees;
+        float elevation;  // Height of the camera over the target, in units of the distance
+    };
+
+    constexpr std::array<Pose, 2> POSES{{{"front", 0.0f, 0.0f}, {"quarter", 45.0f, 0.4f}}};
+
+    bool isEnvSet(const char* name)
+    {
+        const char* value = std::getenv(name);
+        return value != nullptr && std::string(value) == "1";
+    }
+
+    // Model centered on the origin with the camera backed off until its bounding sphere fits the view
+    Camera makeCamera(const Mesh& mesh, const Pose& pose)
+    {
+        const auto extent = mesh.bounds.max - mesh.bounds.min;
+        const float radius = 0.5f * std::sqrt(extent.x * extent.x + extent.y * extent.y + extent.z * extent.z);
+        const float distance = 1.1f * radius / std::sin(FOV_Y / 2.0f);
+
+        const float yaw = pose.yawDegrees * 3.14159265f / 180.0f;
+        Camera camera;
+        camera._position = {-std::sin(yaw) * distance, pose.elevation * distance, -std::cos(yaw) * distance};
+        camera._direction = (vect3_t<float>{0.0f, 0.0f, 0.0f} - camera._position).normalize();
+        return camera;
+    }
+
+    // 0xRRGGBBAA words sit in memory as A, B, G, R on little-endian machines, PNG wants R, G, B, A
+    std::vector<uint32_t> toPngOrder(std::vector<uint32_t> pixels)
+    {
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            std::ranges::transform(pixels, pixels.begin(), [](const uint32_t pixel) { return std::byteswap(pixel); });
+        }
+        return pixels;
+    }
+
+    bool savePng(const std::filesystem::path& path, const std::vector<uint32_t>& pixels)
+    {
+        const auto bytes = toPngOrder(pixels);
+        return lodepng::encode(path.string(), reinterpret_cast<const unsigned char*>(bytes.data()),
+                               static_cast<unsigned>(WIDTH), static_cast<unsigned>(HEIGHT)) == 0;
+    }
+
+    std::map<std::string, double> loadTimings(const std::filesystem::path& path)
+    {
+        std::map<std::string, double> timings;
+        std::ifstream file(path);
+        std::string key;
+        double milliseconds{0.0};
+        while (file >> key >> milliseconds)
+        {
+            timings[key] = milliseconds;
+        }
+        return timings;
+    }
+
+    void saveTimings(const std::filesystem::path& path, const std::map<std::string, double>& timings)
+    {
+        std::ofstream file(path);
+        for (const auto& [key, milliseconds] : timings)
+        {
+            file << key << ' ' << std::fixed << std::setprecision(3) << milliseconds << '\n';
+        }
+    }
+
+    class GoldenRenderer
+    {
+    public:
+        explicit GoldenRenderer(const Asset& asset)
+            : _asset(asset)
+        {
+            const std::filesystem::path assets{ASSETS_DIR};
+            std::vector<vect3_t<float>> vertices;
+            std::vector<Face> faces;
+            LoadOBJFileSimplified(assets / (std::string(asset.name) + ".obj"), vertices, faces);
+
+            const MeshId mesh = _scene.addMesh(makeMesh(std::move(vertices), std::move(faces)));
+
+            TextureId texture{NO_TEXTURE};
+            if (asset.state == Render::RenderingStates::TEXTURED_TRIANGLES)
+            {
+                Texture2dArray loaded;
+                loaded.data = LoadPngToSDLExpectedFormat((assets / (std::string(asset.name) + ".png")).string(),
+                                                         loaded.width, loaded.height);
+                texture = _scene.addTexture(std::move(loaded));
+            }
+
+            const auto& bounds = _scene.mesh(mesh).bounds;
+            const auto center = (bounds.min + bounds.max) * 0.5f;
+            _scene.addInstance(mesh, {.translation = vect3_t<float>{0.0f, 0.0f, 0.0f} - center}, texture);
+        }
+
+        [[nodiscard]] const Mesh& mesh() const { return _scene.mesh(0u); }
+
+        // One complete frame from geometry to the resolved color buffer, single threaded to keep timings stable
+        std::vector<uint32_t> render(const Camera& camera)
+        {
+            Render::GeometryStage geometryStage{{FOV_Y, Z_NEAR, Z_FAR}, std::chrono::milliseconds{16}, nullptr};
+            geometryStage.setScene(&_scene);
+            geometryStage.setCamera(camera);
+
+            const Render::GeometryInput input{
+                .targetWidth = WIDTH,
+                .targetHeight = HEIGHT,
+                .aspectRatio = static_cast<float>(WIDTH) / static_cast<float>(HEIGHT),
+                .isBackFaceCullingEnabled = true,
+                .depthOrder = Render::drawOrder(_asset.state)};
+
+            _target.clear();
+            geometryStage.process(input, _geometry);
+            Render::rasterizeFrame(_geometry, _asset.state, _scene.textures(), _target);
+            _target.color().resolve();
+
+            std::vector<uint32_t> pixels(WIDTH * HEIGHT);
+            const auto* data = reinterpret_cast<const std::byte*>(_target.color().data());
+            for (size_t y = 0; y < HEIGHT; ++y)
+            {
+                std::memcpy(pixels.data() + y * WIDTH, data + y * _target.color().pitch(), WIDTH * sizeof(uint32_t));
+            }
+            return pixels;
+        }
+
+    private:
+        Asset _asset;
+        Scene _scene;
+        Render::RenderTarget _target{WIDTH, HEIGHT, Render::DepthFormat::FLOAT, {Z_NEAR, Z_FAR}};
+        Render::FrameGeometry _geometry;
+    };
+
+    size_t countDifferingPixels(const std::vector<uint32_t>& actual, const std::vector<unsigned char>& reference)
+    {
+        const auto rgba = toPngOrder(actual);
+        const auto* bytes = reinterpret_cast<const unsigned char*>(rgba.data());
+
+        size_t differing{0};
+        for (size_t i = 0; i < WIDTH * HEIGHT; ++i)
+        {
+            for (size_t channel = 0; channel < 4u; ++channel)
+            {
+                if (std::abs(bytes[i * 4u + channel] - reference[i * 4u + channel]) > CHANNEL_TOLERANCE)
+                {
+                    ++differing;
+                    break;
+                }
+            }
+        }
+        return differing;
+    }
+}
+
+TEST_CASE("Every asset renders like its reference images, and no slower")
+{
+    const std::filesystem::path goldenDir{GOLDEN_DIR};
+    const std::filesystem::path outputDir{GOLDEN_OUTPUT_DIR};
+    std::filesystem::create_directories(outputDir);
+
+    const bool isUpdating = isEnvSet("GOLDEN_UPDATE");
+    const bool isTimingGated = isEnvSet("GOLDEN_TIMING");
+    auto timings = isTimingGated ? loadTimings(outputDir / TIMINGS_FILE) : std::map<std::string, double>{};
+    bool isTimingsChanged{false};
+
+    for (const auto& asset : ASSETS)
+    {
+        GoldenRenderer renderer{asset};
+
+        for (const auto& pose : POSES)
+        {
+            const std::string key = std::string(asset.name) + "_" + pose.name;
+            CAPTURE(key);
+
+            const Camera camera = makeCamera(renderer.mesh(), pose);
+            const auto pixels = renderer.render(camera);
+
+            const auto referencePath = goldenDir / (key + ".png");
+            std::vector<unsigned char> reference;
+            unsigned referenceWidth{0};
+            unsigned referenceHeight{0};
+            if (isUpdating)
+            {
+                std::filesystem::create_directories(goldenDir);
+                REQUIRE(savePng(referencePath, pixels));
+                MESSAGE("Recorded reference " << referencePath.string());
+            }
+            else
+            {
+                REQUIRE_MESSAGE(std::filesystem::exists(referencePath),
+                                "No reference " << referencePath.string() << ", record it with GOLDEN_UPDATE=1");
+                REQUIRE(lodepng::decode(reference, referenceWidth, referenceHeight, referencePath.string()) == 0);
+                REQUIRE(referenceWidth == WIDTH);
+                REQUIRE(referenceHeight == HEIGHT);
+
+                const size_t differing = countDifferingPixels(pixels, reference);
+                const auto allowed = static_cast<size_t>(MAX_DIFFERING_PIXELS * WIDTH * HEIGHT);
+                const auto actualPath = outputDir / (key + ".actual.png");
+                if (differing > allowed)
+                {
+                    savePng(actualPath, pixels);
+                }
+                CHECK_MESSAGE(differing <= allowed, differing << " pixels differ, see " << actualPath.string());
+            }
+
+            if (!isTimingGated)
+            {
+                continue;
+            }
+
+            std::array<double, TIMED_RUNS> runs{};
+            for (auto& run : runs)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                renderer.render(camera);
+                run = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            }
+            std::ranges::nth_element(runs, runs.begin() + TIMED_RUNS / 2u);
+            const double median = runs[TIMED_RUNS / 2u];
+
+            const auto recorded = timings.find(key);
+            if (isUpdating || recorded == timings.end())
+            {
+                timings[key] = median;
+                isTimingsChanged = true;
+            }
+            else
+            {
+                const double budget = recorded->second * TIMING_RATIO + TIMING_SLACK_MS;
+                CHECK_MESSAGE(median <= budget, median << " ms, budget " << budget << " ms");
+            }
+        }
+    }
+
+    if (isTimingsChanged)
+    {
+        saveTimings(outputDir / TIMINGS_FILE, timings);
+    }
+}
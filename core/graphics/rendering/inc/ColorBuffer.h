@@ -0,0 +1,84 @@
+#ifndef COLORBUFFER_H
+#define COLORBUFFER_H
+
+#include "graphics/rendering/inc/Framebuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Utils
+{
+class ThreadPool;
+}
+
+namespace Render
+{
+
+constexpr size_t COLOR_TILE_SHIFT = 3u;
+constexpr size_t COLOR_TILE_SIZE = 1u << COLOR_TILE_SHIFT; // 8x8 pixels per tile
+
+// Color target with fast clear: clear() only flags every 8x8 tile as cleared. A tile is filled with the
+// clear value the first time something is written into it, and resolve() fills the tiles nothing touched
+// right before present with streaming stores, so a frame never rewrites pixels it is about to overwrite.
+class ColorBuffer
+{
+public:
+    ColorBuffer(size_t width, size_t height, uint32_t clearValue = 0u);
+
+    [[nodiscard]] size_t width() const { return _pixels.width(); }
+    [[nodiscard]] size_t height() const { return _pixels.height(); }
+    [[nodiscard]] size_t capacityWidth() const { return _pixels.capacityWidth(); }
+    [[nodiscard]] size_t capacityHeight() const { return _pixels.capacityHeight(); }
+    [[nodiscard]] size_t pitch() const { return _pixels.pitch(); }
+
+    // Changes the drawn area within the allocation and clears it
+    void setSize(size_t width, size_t height);
+
+    void clear();
+    void fill(uint32_t color);
+
+    void write(const size_t x, const size_t y, const uint32_t color) { pixel(x, y) = color; }
+
+    // Pixel for a read-modify-write such as a blend; it holds the clear value if its tile was still cleared
+    uint32_t& pixel(const size_t x, const size_t y)
+    {
+        const size_t tileIndex = (y >> COLOR_TILE_SHIFT) * _tilesX + (x >> COLOR_TILE_SHIFT);
+        if (!_tileWritten[tileIndex])
+        {
+            initializeTile(tileIndex);
+        }
+        return _pixels.at(x, y);
+    }
+
+    // Writes color into [x0, x1) of row y
+    void fillSpan(size_t y, size_t x0, size_t x1, uint32_t color);
+
+    [[nodiscard]] uint32_t at(size_t x, size_t y) const;
+
+    // Renders straight into caller-owned memory, e.g. a locked streaming texture, until detach(), which saves
+    // the copy of the finished frame. That memory holds garbage, so every tile starts out cleared and
+    // resolve() still writes the whole width() x height() area.
+    void attach(uint32_t* pixels, size_t pitch);
+    void detach();
+
+    // Fills every tile still flagged as cleared so data() holds the whole frame
+    void resolve(Utils::ThreadPool* threadPool = nullptr);
+
+    // Rows are pitch() bytes apart; only complete after resolve()
+    [[nodiscard]] const uint32_t* data() const { return _pixels.data(); }
+
+private:
+    void initializeTile(size_t tileIndex);
+    void resolveTileRow(size_t tileY);
+
+    size_t _tilesX;
+    size_t _tilesY;
+    uint32_t _clearValue;
+    Framebuffer<uint32_t> _pixels;
+    std::vector<uint8_t> _tileWritten;
+};
+
+}
+
+#endif //COLORBUFFER_H
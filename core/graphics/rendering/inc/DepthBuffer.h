@@ -0,0 +1,200 @@
+#ifndef DEPTHBUFFER_H
+#define DEPTHBUFFER_H
+
+#include "graphics/rendering/inc/Framebuffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <variant>
+#include <vector>
+
+namespace Render
+{
+
+constexpr size_t DEPTH_TILE_SHIFT = 3u;
+constexpr size_t DEPTH_TILE_SIZE = 1u << DEPTH_TILE_SHIFT; // 8x8 pixels per tile
+
+// View-space depth range, only the fixed-point formats need it to normalize 1/w
+struct DepthRange
+{
+    float zNear{0.1f};
+    float zFar{100.0f};
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Depth formats
+///////////////////////////////////////////////////////////////////////////////
+// Every format turns the interpolated 1/w of a fragment into its stored value.
+// encode must be monotonic so a triangle's nearest vertex bounds all of its fragments,
+// isNearer is the depth test and farther keeps the coarse tile level.
+// nearer moves a stored value the given number of representable steps towards the camera,
+// the precision of the format, for what is drawn on top of a surface at its own depth.
+///////////////////////////////////////////////////////////////////////////////
+
+// 32-bit float of 1 - 1/w, smaller is nearer
+struct FloatDepth
+{
+    using Storage = float;
+    static constexpr Storage CLEAR = 1.0f;
+
+    static Storage encode(const float reciprocalW, const DepthRange&) { return 1.0f - reciprocalW; }
+    static bool isNearer(const Storage candidate, const Storage stored) { return candidate < stored; }
+    static Storage farther(const Storage a, const Storage b) { return std::max(a, b); }
+    static Storage nearer(const Storage depth, const uint32_t steps)
+    {
+        return depth - std::abs(depth) * static_cast<float>(steps) * std::numeric_limits<float>::epsilon();
+    }
+};
+
+// Reversed-Z: 1/w itself, larger is nearer. Distant values sit close to 0 where floats are densest,
+// so precision is spread far more evenly over the view distance than with 1 - 1/w
+struct ReversedFloatDepth
+{
+    using Storage = float;
+    static constexpr Storage CLEAR = 0.0f;
+
+    static Storage encode(const float reciprocalW, const DepthRange&) { return reciprocalW; }
+    static bool isNearer(const Storage candidate, const Storage stored) { return candidate > stored; }
+    static Storage farther(const Storage a, const Storage b) { return std::min(a, b); }
+    static Storage nearer(const Storage depth, const uint32_t steps)
+    {
+        return depth + std::abs(depth) * static_cast<float>(steps) * std::numeric_limits<float>::epsilon();
+    }
+};
+
+// Fixed-point depth with BITS of precision: 1/w normalized over [zNear, zFar], 0 at the near plane
+template <typename StorageType, uint32_t BITS>
+struct UnormDepth
+{
+    using Storage = StorageType;
+    static constexpr uint32_t MAX_VALUE = (BITS >= 32u) ? 0xFFFFFFFFu : ((1u << BITS) - 1u);
+    static constexpr Storage CLEAR = static_cast<Storage>(MAX_VALUE);
+
+    static Storage encode(const float reciprocalW, const DepthRange& range)
+    {
+        const float nearReciprocal = 1.0f / range.zNear;
+        const float farReciprocal = 1.0f / range.zFar;
+        const float normalized = (nearReciprocal - reciprocalW) / (nearReciprocal - farReciprocal);
+        const float clamped = std::clamp(normalized, 0.0f, 1.0f);
+        return static_cast<Storage>(std::lround(clamped * static_cast<float>(MAX_VALUE)));
+    }
+    static bool isNearer(const Storage candidate, const Storage stored) { return candidate < stored; }
+    static Storage farther(const Storage a, const Storage b) { return std::max(a, b); }
+    static Storage nearer(const Storage depth, const uint32_t steps)
+    {
+        return depth > steps ? static_cast<Storage>(depth - steps) : Storage{0};
+    }
+};
+
+// Half the memory traffic of the float formats
+using Unorm16Depth = UnormDepth<uint16_t, 16u>;
+// 24 bits kept in a 32-bit word like a D24 buffer without stencil: float bandwidth, uniform precision
+using Unorm24Depth = UnormDepth<uint32_t, 24u>;
+
+///////////////////////////////////////////////////////////////////////////////
+// Per-pixel depth values plus a coarse level holding the farthest depth of every 8x8 tile.
+// Writes only mark their tile dirty; isRectOccluded recomputes the dirty tiles under a triangle once, and
+// the per-span isTileOccluded reads the coarse level as it is. Writes only ever bring depth nearer, so a
+// stale tile reads farther than it is and at worst lets a hidden span through to the per-pixel test.
+// clear() is per tile as well: a cleared tile reads as the clear value and its pixels are only
+// reset on the first write into it, so the full buffer is never rewritten between frames.
+///////////////////////////////////////////////////////////////////////////////
+template <typename Format>
+class DepthBuffer
+{
+public:
+    using Storage = typename Format::Storage;
+
+    DepthBuffer(size_t width, size_t height, DepthRange range = {});
+
+    void clear();
+
+    // Changes the tested area within the allocation and clears it
+    void setSize(size_t width, size_t height);
+
+    [[nodiscard]] size_t width() const { return _values.width(); }
+    [[nodiscard]] size_t height() const { return _values.height(); }
+    [[nodiscard]] size_t tilesX() const { return _tilesX; }
+    [[nodiscard]] size_t tilesY() const { return _tilesY; }
+
+    [[nodiscard]] Storage encode(const float reciprocalW) const { return Format::encode(reciprocalW, _range); }
+
+    [[nodiscard]] Storage at(const size_t x, const size_t y) const
+    {
+        return _tileCleared[tileIndexOf(x, y)] ? Format::CLEAR : _values.at(x, y);
+    }
+
+    [[nodiscard]] bool passes(const size_t x, const size_t y, const Storage depth) const
+    {
+        return Format::isNearer(depth, at(x, y));
+    }
+
+    void write(const size_t x, const size_t y, const Storage depth)
+    {
+        const size_t tileIndex = tileIndexOf(x, y);
+        if (_tileCleared[tileIndex])
+        {
+            initializeTile(tileIndex);
+        }
+        _values.at(x, y) = depth;
+        _tileDirty[tileIndex] = 1u;
+    }
+
+    // Depth tests the fragments [x0, x1) of row y, all inside one tile, whose 1/w starts at reciprocalW and
+    // grows by reciprocalWStep per pixel. Nearer fragments are written, bit i of the result is set when x0 + i
+    // passed. One tile lookup for the whole run and no branch per fragment, for the solid color spans.
+    [[nodiscard]] uint32_t testSpan(size_t y, size_t x0, size_t x1, float reciprocalW, float reciprocalWStep);
+
+    // True when no fragment at nearestDepth or farther can pass the depth test anywhere in the tile,
+    // as of the last time the tile was refreshed by isRectOccluded
+    [[nodiscard]] bool isTileOccluded(size_t tileX, size_t tileY, Storage nearestDepth) const;
+
+    // Refreshes the dirty tiles overlapped by the pixel rectangle [x0, x1) x [y0, y1), then true when every
+    // one of them is occluded. Called once per triangle over its bounds, before its spans query single tiles.
+    [[nodiscard]] bool isRectOccluded(int x0, int y0, int x1, int y1, Storage nearestDepth);
+
+private:
+    [[nodiscard]] size_t tileIndexOf(const size_t x, const size_t y) const
+    {
+        return (y >> DEPTH_TILE_SHIFT) * _tilesX + (x >> DEPTH_TILE_SHIFT);
+    }
+
+    void initializeTile(size_t tileIndex);
+    void refreshTile(size_t tileIndex);
+
+    size_t _tilesX;
+    size_t _tilesY;
+    DepthRange _range;
+    Framebuffer<Storage> _values;
+    std::vector<Storage> _tileFarthest;
+    std::vector<uint8_t> _tileDirty;
+    std::vector<uint8_t> _tileCleared;
+};
+
+extern template class DepthBuffer<FloatDepth>;
+extern template class DepthBuffer<ReversedFloatDepth>;
+extern template class DepthBuffer<Unorm16Depth>;
+extern template class DepthBuffer<Unorm24Depth>;
+
+enum class DepthFormat : uint8_t
+{
+    FLOAT,
+    REVERSED_FLOAT,
+    UNORM16,
+    UNORM24
+};
+
+// Runtime-selected buffer; the rasterizer is instantiated per format and picked with std::visit
+using AnyDepthBuffer = std::variant<DepthBuffer<FloatDepth>,
+                                    DepthBuffer<ReversedFloatDepth>,
+                                    DepthBuffer<Unorm16Depth>,
+                                    DepthBuffer<Unorm24Depth>>;
+
+AnyDepthBuffer makeDepthBuffer(DepthFormat format, size_t width, size_t height, DepthRange range = {});
+
+}
+
+#endif //DEPTHBUFFER_H
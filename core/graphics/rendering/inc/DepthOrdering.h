@@ -0,0 +1,46 @@
+#ifndef DEPTHORDERING_H
+#define DEPTHORDERING_H
+
+#include "utils/inc/RadixSort.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct Triangle;
+
+namespace Utils
+{
+class ThreadPool;
+}
+
+namespace Render
+{
+
+enum class DepthOrder : uint8_t
+{
+    BACK_TO_FRONT, // Painter's algorithm, required when nothing is depth tested
+    FRONT_TO_BACK, // Nearest first so the z-buffer rejects hidden fragments early
+    NONE           // Nothing is drawn in depth order, the triangles are not sorted at all
+};
+
+// Orders triangles by average view depth without moving them: compact (depth key, index) pairs are
+// radix sorted and the result is an index list the raster stage walks in draw order. NONE skips the sort
+// and leaves the list empty.
+class TriangleSorter
+{
+public:
+    const std::vector<uint32_t>& sort(const std::vector<Triangle>& triangles, DepthOrder order,
+                                      Utils::ThreadPool* threadPool = nullptr);
+
+    [[nodiscard]] const std::vector<uint32_t>& drawOrder() const { return _drawOrder; }
+
+private:
+    std::vector<Utils::SortKey> _keys;
+    std::vector<Utils::SortKey> _scratch;
+    std::vector<uint32_t> _drawOrder;
+};
+
+}
+
+#endif //DEPTHORDERING_H
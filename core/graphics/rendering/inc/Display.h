@@ -6,6 +6,7 @@
 #include "graphics/textures/inc/Textures.h"
 
 #include "common/inc/CommonDefines.h"
+#include "graphics/rendering/inc/ColorBuffer.h"
 #include "common/inc/Vectors.hpp"
 
 
@@ -14,6 +15,9 @@ struct Triangle;
 namespace Render
 {
 
+template <typename Format>
+class DepthBuffer;
+
 struct Point
 {
     int32_t x{0};
@@ -29,16 +33,19 @@ enum class LineRasterAlgo : uint8_t
     BRESENHAM
 };
 
-void drawGrid(ColorBufferArray& colorBuffer, uint32_t gridColor = toColorValue(Colors::BLACK), size_t gridSpacing = 10u , size_t gridWidth = 1u);
-void drawRect(ColorBufferArray& colorBuffer, int posX, int posY, size_t width, size_t height, uint32_t color);
-void drawPixel(ColorBufferArray& colorBuffer, int posX, int posY, uint32_t color);
-void drawTriangle(ColorBufferArray& colorBuffer, const Point& point1, const Point& point2, const Point& point3, size_t color = toColorValue(Colors::WHITE), LineRasterAlgo
+void drawGrid(ColorBuffer& colorBuffer, uint32_t gridColor = toColorValue(Colors::BLACK), size_t gridSpacing = 10u , size_t gridWidth = 1u);
+void drawRect(ColorBuffer& colorBuffer, int posX, int posY, size_t width, size_t height, uint32_t color);
+void drawPixel(ColorBuffer& colorBuffer, int posX, int posY, uint32_t color);
+void drawTriangle(ColorBuffer& colorBuffer, const Point& point1, const Point& point2, const Point& point3, size_t color = toColorValue(Colors::WHITE), LineRasterAlgo
               algoType = LineRasterAlgo::DDA);
-void drawLine(ColorBufferArray& colorBuffer, const Point& startPoint, const Point& endPoint,
+void drawLine(ColorBuffer& colorBuffer, const Point& startPoint, const Point& endPoint,
               LineRasterAlgo algoType = LineRasterAlgo::DDA, uint32_t  color = toColorValue(Colors::WHITE));
 vect2_t<float> projectNonMatrix(const vect3_t<float>& point);
-void drawFilledTriangleFlatBottom(ColorBufferArray& colorBuffer, const Triangle& triangle, size_t color = toColorValue(Colors::WHITE));
-void drawTexturedTriangle(ColorBufferArray& colorBuffer, const Triangle& triangle, Texture2dArray& texture, ZBufferArray &zBuffer);
+// Both instantiated for every format in DepthBuffer.h
+template <typename DepthFormat>
+void drawFlatTriangle(ColorBuffer& colorBuffer, const Triangle& triangle, uint32_t color, DepthBuffer<DepthFormat>& depthBuffer);
+template <typename DepthFormat>
+void drawTexturedTriangle(ColorBuffer& colorBuffer, const Triangle& triangle, const Texture2dArray& texture, DepthBuffer<DepthFormat>& depthBuffer);
 }
 
 #endif //DISPLAY_H
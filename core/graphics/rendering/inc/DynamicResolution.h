@@ -0,0 +1,39 @@
+#ifndef DYNAMICRESOLUTION_H
+#define DYNAMICRESOLUTION_H
+
+#include <cstddef>
+
+namespace Render
+{
+
+// Picks the render scale that keeps the raster cost of a frame under a target. It grows with the pixel count,
+// so the next scale is predicted from the smoothed cost as scale * sqrt(target / cost). Steps are limited
+// per frame and tiny corrections are ignored, so the resolution settles instead of oscillating.
+class DynamicResolution
+{
+public:
+    explicit DynamicResolution(float targetFrameMs, float minScale = 0.5f, float maxScale = 1.0f);
+
+    // Feeds the raster cost of the frame rendered at scale() and returns the scale for the next one
+    float update(float frameCostMs);
+
+    [[nodiscard]] float scale() const { return _scale; }
+
+    // Back to full scale with no cost history
+    void reset();
+
+    // Dimension at the given scale, rounded to whole 8 pixel tiles and never above fullSize
+    [[nodiscard]] static size_t scaleDimension(size_t fullSize, float scale);
+
+private:
+    float _targetFrameMs;
+    float _minScale;
+    float _maxScale;
+    float _scale;
+    float _averageCostMs{0.0f};
+    bool _hasSample{false};
+};
+
+}
+
+#endif //DYNAMICRESOLUTION_H
@@ -0,0 +1,100 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include "utils/inc/FramebufferMemory.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace Render
+{
+
+// 2D pixel storage with cache-line aligned rows. Rows are stride() elements apart, which can be more
+// than width(), so every access goes through row() or at() and never through y * width.
+// The visible size can shrink below the allocated capacity and grow back without reallocating.
+// The pixels can also live in memory owned by someone else for a while, see attach().
+template <typename T>
+class Framebuffer
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Framebuffer elements are filled and copied as raw memory");
+
+public:
+    Framebuffer(const size_t width, const size_t height, const T initialValue = T{}, const bool useHugePages = true)
+        : _width(width)
+        , _height(height)
+        , _capacityWidth(width)
+        , _capacityHeight(height)
+        , _stride(Utils::alignedStride(width, sizeof(T)))
+        , _memory(Utils::allocateFramebufferMemory(_stride * height * sizeof(T), useHugePages))
+        , _data(reinterpret_cast<T*>(_memory.get()))
+    {
+        fill(initialValue);
+    }
+
+    [[nodiscard]] size_t width() const { return _width; }
+    [[nodiscard]] size_t height() const { return _height; }
+    [[nodiscard]] size_t capacityWidth() const { return _capacityWidth; }
+    [[nodiscard]] size_t capacityHeight() const { return _capacityHeight; }
+    [[nodiscard]] size_t stride() const { return _stride; }
+    [[nodiscard]] size_t pitch() const { return _stride * sizeof(T); }
+
+    [[nodiscard]] T* data() { return _data; }
+    [[nodiscard]] const T* data() const { return _data; }
+
+    [[nodiscard]] T* row(const size_t y) { return data() + y * _stride; }
+    [[nodiscard]] const T* row(const size_t y) const { return data() + y * _stride; }
+
+    [[nodiscard]] T& at(const size_t x, const size_t y) { return row(y)[x]; }
+    [[nodiscard]] const T& at(const size_t x, const size_t y) const { return row(y)[x]; }
+
+    // Rows keep the allocated stride, so the pixels left outside the new size are simply ignored
+    void setSize(const size_t width, const size_t height)
+    {
+        _width = std::min(width, _capacityWidth);
+        _height = std::min(height, _capacityHeight);
+    }
+
+    // Redirects every access to external memory of at least width() x height() elements with rows pitch
+    // bytes apart, e.g. a locked streaming texture, until detach(). The own allocation is left untouched.
+    void attach(T* external, const size_t pitch)
+    {
+        _data = external;
+        _stride = pitch / sizeof(T);
+    }
+
+    void detach()
+    {
+        _data = reinterpret_cast<T*>(_memory.get());
+        _stride = Utils::alignedStride(_capacityWidth, sizeof(T));
+    }
+
+    [[nodiscard]] bool isAttached() const { return _data != reinterpret_cast<const T*>(_memory.get()); }
+
+    // Whole allocation, padding included, it is never read back. Attached, only the visible rows are owned.
+    void fill(const T value)
+    {
+        if (isAttached())
+        {
+            for (size_t y = 0; y < _height; ++y)
+            {
+                std::fill_n(row(y), _width, value);
+            }
+            return;
+        }
+        std::fill_n(data(), _stride * _capacityHeight, value);
+    }
+
+private:
+    size_t _width;
+    size_t _height;
+    size_t _capacityWidth;
+    size_t _capacityHeight;
+    size_t _stride;
+    Utils::FramebufferMemory _memory;
+    T* _data;
+};
+
+}
+
+#endif //FRAMEBUFFER_H
@@ -0,0 +1,45 @@
+#ifndef LINERASTERIZER_H
+#define LINERASTERIZER_H
+
+#include "graphics/rendering/inc/ColorBuffer.h"
+
+#include <cstdint>
+
+namespace Render
+{
+
+template <typename Format>
+class DepthBuffer;
+
+// End of a wireframe segment in screen space. 1/w is affine along the segment like over a triangle,
+// only the depth-tested lines read it.
+struct LineVertex
+{
+    float x{0.0f};
+    float y{0.0f};
+    float reciprocalW{0.0f};
+};
+
+// Wireframe lines: the segment is clipped to the buffer with Liang-Barsky first, so off-screen parts cost
+// nothing, then walked with integer Bresenham steps from one rounded end point to the other, both included.
+// Pixels go straight into the color buffer with no per-pixel bounds check.
+void drawWireLine(ColorBuffer& colorBuffer, LineVertex start, LineVertex end, uint32_t color);
+
+// Same line as an overlay on filled triangles: a pixel is only written where the line is not behind what
+// the depth buffer holds. The depth buffer is read, never written. Like a polygon offset, the line is moved
+// towards the camera by half a pixel of reciprocalWSlope, the |d(1/w)/dx| + |d(1/w)/dy| of the triangle it
+// outlines, plus a few steps of the depth format: the fill was sampled at pixel centers up to half a pixel
+// off the edge, so the edges win over their own fill and still stay behind anything in front of it.
+// Instantiated for every format in DepthBuffer.h
+template <typename DepthFormat>
+void drawWireLine(ColorBuffer& colorBuffer, LineVertex start, LineVertex end, uint32_t color, float reciprocalWSlope,
+                  const DepthBuffer<DepthFormat>& depthBuffer);
+
+// Anti-aliased line after Xiaolin Wu, clipped the same way. Each step along the major axis covers the two
+// pixels straddling the line and blends the color into them by coverage, both in one SIMD operation.
+// End points at pixel centers get half coverage, so the corners where wireframe edges meet are not doubled.
+void drawWireLineAntialiased(ColorBuffer& colorBuffer, LineVertex start, LineVertex end, uint32_t color);
+
+}
+
+#endif //LINERASTERIZER_H
@@ -0,0 +1,55 @@
+#ifndef RENDERTARGET_H
+#define RENDERTARGET_H
+
+#include "graphics/rendering/inc/ColorBuffer.h"
+#include "graphics/rendering/inc/DepthBuffer.h"
+
+#include <cstddef>
+
+namespace Render
+{
+
+// Color and depth buffers of one internal resolution. The pipeline takes its size from here rather than
+// from the window, so the frame can be rendered smaller than the window and scaled up on present.
+// The buffers are allocated at a capacity; the render size can drop below it every frame without reallocating.
+class RenderTarget
+{
+public:
+    RenderTarget(size_t width, size_t height, DepthFormat depthFormat = DepthFormat::FLOAT, DepthRange depthRange = {});
+
+    [[nodiscard]] size_t width() const { return _color.width(); }
+    [[nodiscard]] size_t height() const { return _color.height(); }
+    [[nodiscard]] size_t capacityWidth() const { return _color.capacityWidth(); }
+    [[nodiscard]] size_t capacityHeight() const { return _color.capacityHeight(); }
+
+    // Aspect of the full capacity: a scaled-down frame is stretched back to it on present
+    [[nodiscard]] float aspectRatio() const
+    {
+        return static_cast<float>(capacityWidth()) / static_cast<float>(capacityHeight());
+    }
+
+    [[nodiscard]] ColorBuffer& color() { return _color; }
+    [[nodiscard]] const ColorBuffer& color() const { return _color; }
+    [[nodiscard]] AnyDepthBuffer& depth() { return _depth; }
+
+    [[nodiscard]] DepthFormat depthFormat() const { return _depthFormat; }
+    void setDepthFormat(DepthFormat depthFormat);
+
+    // Reallocates both buffers at a new capacity, their previous content is lost
+    void resize(size_t width, size_t height);
+
+    // Renders into the top-left width x height of the allocation, clamped to the capacity
+    void setRenderSize(size_t width, size_t height);
+
+    void clear();
+
+private:
+    DepthFormat _depthFormat;
+    DepthRange _depthRange;
+    ColorBuffer _color;
+    AnyDepthBuffer _depth;
+};
+
+}
+
+#endif //RENDERTARGET_H
@@ -0,0 +1,187 @@
+#include "graphics/rendering/inc/ColorBuffer.h"
+
+#include "utils/inc/ThreadPool.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    // Fills count pixels with regular unaligned stores, 4 per instruction, for spans the rasterizer writes
+    void storeFill(uint32_t* destination, size_t count, const uint32_t value)
+    {
+#if defined(__SSE2__)
+        constexpr size_t PIXELS_PER_STORE = sizeof(__m128i) / sizeof(uint32_t);
+
+        const __m128i splat = _mm_set1_epi32(static_cast<int>(value));
+        for (; count >= PIXELS_PER_STORE; count -= PIXELS_PER_STORE, destination += PIXELS_PER_STORE)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), splat);
+        }
+#endif
+        std::fill_n(destination, count, value);
+    }
+
+    // Fills count pixels with non-temporal stores: the resolved pixels are only read back by the upload,
+    // so there is no point pulling their cache lines in first
+    void streamFill(uint32_t* destination, size_t count, const uint32_t value)
+    {
+#if defined(__SSE2__)
+        constexpr size_t PIXELS_PER_STORE = sizeof(__m128i) / sizeof(uint32_t);
+
+        while (count > 0 && (reinterpret_cast<uintptr_t>(destination) & (sizeof(__m128i) - 1)) != 0)
+        {
+            *destination++ = value;
+            --count;
+        }
+
+        const __m128i splat = _mm_set1_epi32(static_cast<int>(value));
+        for (; count >= PIXELS_PER_STORE; count -= PIXELS_PER_STORE, destination += PIXELS_PER_STORE)
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(destination), splat);
+        }
+#endif
+        std::fill_n(destination, count, value);
+    }
+}
+
+namespace Render
+{
+
+ColorBuffer::ColorBuffer(const size_t width, const size_t height, const uint32_t clearValue)
+    : _tilesX((width + COLOR_TILE_SIZE - 1) >> COLOR_TILE_SHIFT)
+    , _tilesY((height + COLOR_TILE_SIZE - 1) >> COLOR_TILE_SHIFT)
+    , _clearValue(clearValue)
+    , _pixels(width, height, clearValue)
+    , _tileWritten(_tilesX * _tilesY, 1u)
+{
+}
+
+void ColorBuffer::setSize(const size_t width, const size_t height)
+{
+    _pixels.setSize(width, height);
+    _tilesX = (_pixels.width() + COLOR_TILE_SIZE - 1) >> COLOR_TILE_SHIFT;
+    _tilesY = (_pixels.height() + COLOR_TILE_SIZE - 1) >> COLOR_TILE_SHIFT;
+    _tileWritten.assign(_tilesX * _tilesY, 0u);
+}
+
+void ColorBuffer::attach(uint32_t* pixels, const size_t pitch)
+{
+    _pixels.attach(pixels, pitch);
+    clear();
+}
+
+void ColorBuffer::detach()
+{
+    // The own allocation missed the frame drawn while attached
+    _pixels.detach();
+    clear();
+}
+
+void ColorBuffer::clear()
+{
+    std::ranges::fill(_tileWritten, 0u);
+}
+
+void ColorBuffer::fill(const uint32_t color)
+{
+    _pixels.fill(color);
+    std::ranges::fill(_tileWritten, 1u);
+}
+
+void ColorBuffer::fillSpan(const size_t y, const size_t x0, const size_t x1, const uint32_t color)
+{
+    if (x0 >= x1)
+    {
+        return;
+    }
+
+    const size_t tileRow = (y >> COLOR_TILE_SHIFT) * _tilesX;
+    for (size_t tileX = x0 >> COLOR_TILE_SHIFT; tileX <= (x1 - 1) >> COLOR_TILE_SHIFT; ++tileX)
+    {
+        if (!_tileWritten[tileRow + tileX])
+        {
+            initializeTile(tileRow + tileX);
+        }
+    }
+
+    storeFill(_pixels.row(y) + x0, x1 - x0, color);
+}
+
+uint32_t ColorBuffer::at(const size_t x, const size_t y) const
+{
+    const size_t tileIndex = (y >> COLOR_TILE_SHIFT) * _tilesX + (x >> COLOR_TILE_SHIFT);
+    return _tileWritten[tileIndex] ? _pixels.at(x, y) : _clearValue;
+}
+
+void ColorBuffer::initializeTile(const size_t tileIndex)
+{
+    const size_t x0 = (tileIndex % _tilesX) << COLOR_TILE_SHIFT;
+    const size_t y0 = (tileIndex / _tilesX) << COLOR_TILE_SHIFT;
+    const size_t x1 = std::min(x0 + COLOR_TILE_SIZE, _pixels.width());
+    const size_t y1 = std::min(y0 + COLOR_TILE_SIZE, _pixels.height());
+
+    // Regular stores here: the tile is about to be written by the rasterizer
+    for (size_t y = y0; y < y1; ++y)
+    {
+        std::fill_n(_pixels.row(y) + x0, x1 - x0, _clearValue);
+    }
+    _tileWritten[tileIndex] = 1u;
+}
+
+void ColorBuffer::resolveTileRow(const size_t tileY)
+{
+    const size_t y0 = tileY << COLOR_TILE_SHIFT;
+    const size_t y1 = std::min(y0 + COLOR_TILE_SIZE, _pixels.height());
+    uint8_t* tileFlags = _tileWritten.data() + tileY * _tilesX;
+
+    // Neighbouring cleared tiles are filled as one run per pixel row to keep the streams long
+    size_t tileX = 0;
+    while (tileX < _tilesX)
+    {
+        if (tileFlags[tileX])
+        {
+            ++tileX;
+            continue;
+        }
+
+        const size_t runStart = tileX;
+        while (tileX < _tilesX && !tileFlags[tileX])
+        {
+            tileFlags[tileX++] = 1u;
+        }
+
+        const size_t x0 = runStart << COLOR_TILE_SHIFT;
+        const size_t x1 = std::min(tileX << COLOR_TILE_SHIFT, _pixels.width());
+        for (size_t y = y0; y < y1; ++y)
+        {
+            streamFill(_pixels.row(y) + x0, x1 - x0, _clearValue);
+        }
+    }
+
+#if defined(__SSE2__)
+    // Streaming stores are weakly ordered; fence on the thread that issued them before the upload reads the row
+    _mm_sfence();
+#endif
+}
+
+void ColorBuffer::resolve(Utils::ThreadPool* threadPool)
+{
+    if (threadPool != nullptr && threadPool->size() > 1)
+    {
+        threadPool->parallelFor(_tilesY, [this](const size_t tileY) { resolveTileRow(tileY); });
+    }
+    else
+    {
+        for (size_t tileY = 0; tileY < _tilesY; ++tileY)
+        {
+            resolveTileRow(tileY);
+        }
+    }
+}
+
+}
@@ -0,0 +1,165 @@
+#include "graphics/rendering/inc/DepthBuffer.h"
+
+#include <algorithm>
+
+namespace Render
+{
+
+template <typename Format>
+DepthBuffer<Format>::DepthBuffer(const size_t width, const size_t height, const DepthRange range)
+    : _tilesX((width + DEPTH_TILE_SIZE - 1) >> DEPTH_TILE_SHIFT)
+    , _tilesY((height + DEPTH_TILE_SIZE - 1) >> DEPTH_TILE_SHIFT)
+    , _range(range)
+    , _values(width, height, Format::CLEAR)
+    , _tileFarthest(_tilesX * _tilesY, Format::CLEAR)
+    , _tileDirty(_tilesX * _tilesY, 0u)
+    , _tileCleared(_tilesX * _tilesY, 0u)
+{
+}
+
+template <typename Format>
+void DepthBuffer<Format>::clear()
+{
+    std::ranges::fill(_tileFarthest, Format::CLEAR);
+    std::ranges::fill(_tileDirty, 0u);
+    std::ranges::fill(_tileCleared, 1u);
+}
+
+template <typename Format>
+void DepthBuffer<Format>::setSize(const size_t width, const size_t height)
+{
+    _values.setSize(width, height);
+    _tilesX = (_values.width() + DEPTH_TILE_SIZE - 1) >> DEPTH_TILE_SHIFT;
+    _tilesY = (_values.height() + DEPTH_TILE_SIZE - 1) >> DEPTH_TILE_SHIFT;
+    _tileFarthest.assign(_tilesX * _tilesY, Format::CLEAR);
+    _tileDirty.assign(_tilesX * _tilesY, 0u);
+    _tileCleared.assign(_tilesX * _tilesY, 1u);
+}
+
+template <typename Format>
+void DepthBuffer<Format>::initializeTile(const size_t tileIndex)
+{
+    const size_t x0 = (tileIndex % _tilesX) << DEPTH_TILE_SHIFT;
+    const size_t y0 = (tileIndex / _tilesX) << DEPTH_TILE_SHIFT;
+    const size_t x1 = std::min(x0 + DEPTH_TILE_SIZE, _values.width());
+    const size_t y1 = std::min(y0 + DEPTH_TILE_SIZE, _values.height());
+
+    for (size_t y = y0; y < y1; ++y)
+    {
+        std::fill_n(_values.row(y) + x0, x1 - x0, Format::CLEAR);
+    }
+    _tileCleared[tileIndex] = 0u;
+}
+
+template <typename Format>
+uint32_t DepthBuffer<Format>::testSpan(const size_t y, const size_t x0, const size_t x1, float reciprocalW,
+                                       const float reciprocalWStep)
+{
+    const size_t tileIndex = tileIndexOf(x0, y);
+    if (_tileCleared[tileIndex])
+    {
+        initializeTile(tileIndex);
+    }
+
+    Storage* row = _values.row(y);
+    uint32_t passed{0};
+    for (size_t x = x0; x < x1; ++x, reciprocalW += reciprocalWStep)
+    {
+        const Storage depth = encode(reciprocalW);
+        const bool isNearer = Format::isNearer(depth, row[x]);
+        row[x] = isNearer ? depth : row[x];
+        passed |= static_cast<uint32_t>(isNearer) << (x - x0);
+    }
+
+    if (passed != 0u)
+    {
+        _tileDirty[tileIndex] = 1u;
+    }
+    return passed;
+}
+
+template <typename Format>
+bool DepthBuffer<Format>::isTileOccluded(const size_t tileX, const size_t tileY, const Storage nearestDepth) const
+{
+    return !Format::isNearer(nearestDepth, _tileFarthest[tileY * _tilesX + tileX]);
+}
+
+template <typename Format>
+bool DepthBuffer<Format>::isRectOccluded(const int x0, const int y0, const int x1, const int y1, const Storage nearestDepth)
+{
+    const int clampedX0 = std::max(x0, 0);
+    const int clampedY0 = std::max(y0, 0);
+    const int clampedX1 = std::min(x1, static_cast<int>(_values.width()));
+    const int clampedY1 = std::min(y1, static_cast<int>(_values.height()));
+
+    if (clampedX0 >= clampedX1 || clampedY0 >= clampedY1)
+    {
+        return true;
+    }
+
+    const size_t firstTileX = static_cast<size_t>(clampedX0) >> DEPTH_TILE_SHIFT;
+    const size_t lastTileX = static_cast<size_t>(clampedX1 - 1) >> DEPTH_TILE_SHIFT;
+    const size_t firstTileY = static_cast<size_t>(clampedY0) >> DEPTH_TILE_SHIFT;
+    const size_t lastTileY = static_cast<size_t>(clampedY1 - 1) >> DEPTH_TILE_SHIFT;
+
+    // No early out, the spans of the triangle rely on every tile under it being refreshed
+    bool isOccluded{true};
+    for (size_t tileY = firstTileY; tileY <= lastTileY; ++tileY)
+    {
+        for (size_t tileX = firstTileX; tileX <= lastTileX; ++tileX)
+        {
+            const size_t tileIndex = tileY * _tilesX + tileX;
+            if (_tileDirty[tileIndex])
+            {
+                refreshTile(tileIndex);
+            }
+            isOccluded = isOccluded && isTileOccluded(tileX, tileY, nearestDepth);
+        }
+    }
+
+    return isOccluded;
+}
+
+template <typename Format>
+void DepthBuffer<Format>::refreshTile(const size_t tileIndex)
+{
+    const size_t tileX = tileIndex % _tilesX;
+    const size_t tileY = tileIndex / _tilesX;
+
+    const size_t x0 = tileX << DEPTH_TILE_SHIFT;
+    const size_t y0 = tileY << DEPTH_TILE_SHIFT;
+    const size_t x1 = std::min(x0 + DEPTH_TILE_SIZE, _values.width());
+    const size_t y1 = std::min(y0 + DEPTH_TILE_SIZE, _values.height());
+
+    Storage farthest = _values.at(x0, y0);
+    for (size_t y = y0; y < y1; ++y)
+    {
+        const Storage* row = _values.row(y);
+        for (size_t x = x0; x < x1; ++x)
+        {
+            farthest = Format::farther(farthest, row[x]);
+        }
+    }
+
+    _tileFarthest[tileIndex] = farthest;
+    _tileDirty[tileIndex] = 0u;
+}
+
+template class DepthBuffer<FloatDepth>;
+template class DepthBuffer<ReversedFloatDepth>;
+template class DepthBuffer<Unorm16Depth>;
+template class DepthBuffer<Unorm24Depth>;
+
+AnyDepthBuffer makeDepthBuffer(const DepthFormat format, const size_t width, const size_t height, const DepthRange range)
+{
+    switch (format)
+    {
+        case DepthFormat::REVERSED_FLOAT: return AnyDepthBuffer{std::in_place_type<DepthBuffer<ReversedFloatDepth>>, width, height, range};
+        case DepthFormat::UNORM16:        return AnyDepthBuffer{std::in_place_type<DepthBuffer<Unorm16Depth>>, width, height, range};
+        case DepthFormat::UNORM24:        return AnyDepthBuffer{std::in_place_type<DepthBuffer<Unorm24Depth>>, width, height, range};
+        case DepthFormat::FLOAT:
+        default:                          return AnyDepthBuffer{std::in_place_type<DepthBuffer<FloatDepth>>, width, height, range};
+    }
+}
+
+}
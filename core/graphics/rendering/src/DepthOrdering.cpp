@@ -0,0 +1,37 @@
+#include "graphics/rendering/inc/DepthOrdering.h"
+#include "graphics/shapes/inc/Triangle.h"
+
+namespace Render
+{
+
+const std::vector<uint32_t>& TriangleSorter::sort(const std::vector<Triangle>& triangles, const DepthOrder order,
+                                                  Utils::ThreadPool* threadPool)
+{
+    if (order == DepthOrder::NONE)
+    {
+        _drawOrder.clear();
+        return _drawOrder;
+    }
+
+    const size_t count = triangles.size();
+    _keys.resize(count);
+
+    // Inverting the key turns the ascending radix sort into a farthest-first order
+    const uint32_t keyFlip = (order == DepthOrder::BACK_TO_FRONT) ? 0xFFFFFFFFu : 0u;
+    for (size_t i = 0; i < count; ++i)
+    {
+        _keys[i] = {Utils::toSortableKey(triangles[i].getAvgDepth()) ^ keyFlip, static_cast<uint32_t>(i)};
+    }
+
+    Utils::radixSort(_keys, _scratch, threadPool);
+
+    _drawOrder.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        _drawOrder[i] = _keys[i].index;
+    }
+
+    return _drawOrder;
+}
+
+}
@@ -1,4 +1,5 @@
 #include "graphics/rendering/inc/Display.h"
+#include "graphics/rendering/inc/DepthBuffer.h"
 #include "graphics/shapes/inc/Triangle.h"
 
 #include "common/inc/Colors.h"
@@ -7,8 +8,8 @@
 #include "common/inc/Math3D.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
-#include <span>
 
 #include "glm/mat4x4.hpp"
 #include "logger/LogHelper.h"
@@ -25,21 +26,21 @@ namespace
 namespace Render
 {
 
-void drawGrid(ColorBufferArray& colorBuffer, uint32_t gridColor, size_t gridSpacing, size_t gridWidth)
+void drawGrid(ColorBuffer& colorBuffer, uint32_t gridColor, size_t gridSpacing, size_t gridWidth)
 {
-    for (size_t i{0u}; i < colorBuffer.size(); i++)
+    for (size_t rowIndex{0u}; rowIndex < colorBuffer.height(); rowIndex++)
     {
-        size_t columnIndex = i % WINDOW_WIDTH;
-        size_t rowIndex = i / WINDOW_WIDTH;
-
-        if (columnIndex % gridSpacing < gridWidth || rowIndex % gridSpacing < gridWidth)
+        for (size_t columnIndex{0u}; columnIndex < colorBuffer.width(); columnIndex++)
         {
-            colorBuffer[i] = gridColor;
+            if (columnIndex % gridSpacing < gridWidth || rowIndex % gridSpacing < gridWidth)
+            {
+                colorBuffer.write(columnIndex, rowIndex, gridColor);
+            }
         }
     }
 }
 
-void drawRect(ColorBufferArray& colorBuffer, const int posX, const int posY, const size_t width, const size_t height, const uint32_t color)
+void drawRect(ColorBuffer& colorBuffer, const int posX, const int posY, const size_t width, const size_t height, const uint32_t color)
 {
     if (width == 0 || height == 0) {
         return;
@@ -48,8 +49,8 @@ void drawRect(ColorBufferArray& colorBuffer, const int posX, const int posY, con
     // Clip rect to screen bounds
     const int x0 = std::max(0, posX);
     const int y0 = std::max(0, posY);
-    const int x1 = std::min<int>(static_cast<int>(WINDOW_WIDTH),  posX + static_cast<int>(width));
-    const int y1 = std::min<int>(static_cast<int>(WINDOW_HEIGHT), posY + static_cast<int>(height));
+    const int x1 = std::min<int>(static_cast<int>(colorBuffer.width()),  posX + static_cast<int>(width));
+    const int y1 = std::min<int>(static_cast<int>(colorBuffer.height()), posY + static_cast<int>(height));
 
     if (x0 >= x1 || y0 >= y1) {
         return;
@@ -57,33 +58,25 @@ void drawRect(ColorBufferArray& colorBuffer, const int posX, const int posY, con
 
     for (int y = y0; y < y1; ++y)
     {
-        const size_t startIdx = static_cast<size_t>(y) * WINDOW_WIDTH + static_cast<size_t>(x0);
-        const size_t rowWidth = static_cast<size_t>(x1 - x0);
-
-        auto row = std::span(colorBuffer.data() + startIdx, rowWidth);
-        std::ranges::fill(row, color);
+        colorBuffer.fillSpan(static_cast<size_t>(y), static_cast<size_t>(x0), static_cast<size_t>(x1), color);
     }
 }
 
-void drawPixel(ColorBufferArray& colorBuffer, const int posX, const int posY, const uint32_t color)
+void drawPixel(ColorBuffer& colorBuffer, const int posX, const int posY, const uint32_t color)
 {
     // Proper bounds check (also allows drawing at x==0 or y==0)
     if (posX < 0 || posY < 0) {
         return;
     }
 
-    if (posX >= static_cast<int>(WINDOW_WIDTH) || posY >= static_cast<int>(WINDOW_HEIGHT)) {
+    if (posX >= static_cast<int>(colorBuffer.width()) || posY >= static_cast<int>(colorBuffer.height())) {
         return;
     }
 
-    const size_t index = WINDOW_WIDTH * posY + posX;
-    if (index < colorBuffer.size())
-    {
-        colorBuffer[index] = color;
-    }
+    colorBuffer.write(static_cast<size_t>(posX), static_cast<size_t>(posY), color);
 }
 
-void drawTriangle(ColorBufferArray& colorBuffer,
+void drawTriangle(ColorBuffer& colorBuffer,
               const Point& point1, const Point& point2, const Point& point3,
               size_t color, LineRasterAlgo algoType)
 {
@@ -98,7 +91,7 @@ vect2_t<float> projectNonMatrix(const vect3_t<float>& point)
     return fovFactor * vect2_t<float>{point.x / point.z ,point.y / point.z};
 }
 
-void drawLine(ColorBufferArray& colorBuffer, const Point& startPoint, const Point& endPoint, const LineRasterAlgo algoType, uint32_t color)
+void drawLine(ColorBuffer& colorBuffer, const Point& startPoint, const Point& endPoint, const LineRasterAlgo algoType, uint32_t color)
 {
     auto drawWithDDAAlgo = [&]()
     {
@@ -195,123 +188,91 @@ void drawLine(ColorBufferArray& colorBuffer, const Point& startPoint, const Poin
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// Draw a filled a triangle with a flat bottom
+// Draw a solid color triangle, one span per scanline
 ///////////////////////////////////////////////////////////////////////////////
 //
-//        (x0,y0)
-//          / \
-//         /   \
-//        /     \
-//       /       \
-//      /         \
-//  (x1,y1)------(x2,y2)
+// Rows and columns are covered with the same ceil rule as the textured fill,
+// so both modes cover the same pixels and neighbours share no pixel. Every span
+// is clipped to the screen once, then depth tested and written as runs.
+// There is no coarse tile rejection: a solid fragment costs less than keeping
+// the farthest depth of the tiles up to date.
 //
 ///////////////////////////////////////////////////////////////////////////////
-void drawFlatBottomTriangle(ColorBufferArray& colorBuffer, Triangle& triangle, const size_t color)
+template <typename DepthFormat>
+void drawFlatTriangle(ColorBuffer& colorBuffer, const Triangle& triangle, const uint32_t color, DepthBuffer<DepthFormat>& depthBuffer)
 {
-    auto [point0, point1, point2] = triangle._points;
-    const float  MAX_WIDTH = std::abs(point2.x - point1.x);
+    auto points = triangle._points;
+    std::ranges::sort(points, {}, [](const glm::vec4& point) { return point.y; });
+    const auto& [v0, v1, v2] = points;
 
-    float dy1 = point1.y - point0.y;
-    float dy2 = point2.y - point0.y;
+    const float area = (v1.x - v0.x) * (v2.y - v0.y) - (v2.x - v0.x) * (v1.y - v0.y);
+    if (std::abs(area) < EPSILON)
+        return; // Degenerate triangle
 
-    if (std::abs(dy1) < EPSILON || std::abs(dy2) < EPSILON)
-        return;
+    // 1/w is affine in screen space, so its plane gives every fragment depth with one add per pixel
+    const float reciprocalW0 = 1.0f / v0.w;
+    const float deltaW1 = 1.0f / v1.w - reciprocalW0;
+    const float deltaW2 = 1.0f / v2.w - reciprocalW0;
+    const float reciprocalWStepX = (deltaW1 * (v2.y - v0.y) - deltaW2 * (v1.y - v0.y)) / area;
+    const float reciprocalWStepY = (deltaW2 * (v1.x - v0.x) - deltaW1 * (v2.x - v0.x)) / area;
 
-    float invSlop1 = (point1.x - point0.x) / dy1;
-    float invSlop2 = (point2.x - point0.x) / dy2;
+    // The long edge v0-v2 is on one side of every row, the upper or lower short edge on the other
+    const float slopeLong = (v2.x - v0.x) / (v2.y - v0.y);
+    const float slopeUpper = v1.y > v0.y ? (v1.x - v0.x) / (v1.y - v0.y) : 0.0f;
+    const float slopeLower = v2.y > v1.y ? (v2.x - v1.x) / (v2.y - v1.y) : 0.0f;
 
-    float xStart = std::round(point0.x);
-    float xEnd = std::round(point0.x);
+    const int width = static_cast<int>(depthBuffer.width());
+    const int startY = std::max(static_cast<int>(std::ceil(v0.y)), 0);
+    const int endY = std::min(static_cast<int>(std::ceil(v2.y)), static_cast<int>(depthBuffer.height()));
 
-    for (int y = static_cast<int>(point0.y); y <= static_cast<int>(point2.y); y++)  // Ensure proper loop termination
+    for (int y = startY; y < endY; y++)
     {
-        drawLine(colorBuffer, {static_cast<int>(xStart), y}, {static_cast<int>(xEnd), y}, LineRasterAlgo::BRESENHAM, color);
-        xStart += invSlop1;
-        xEnd += invSlop2;
-
+        const auto rowY = static_cast<float>(y);
+        const float xLong = v0.x + (rowY - v0.y) * slopeLong;
+        const float xShort = rowY < v1.y ? v0.x + (rowY - v0.y) * slopeUpper : v1.x + (rowY - v1.y) * slopeLower;
 
-        if (std::abs(xStart - xEnd) > MAX_WIDTH)
+        const int xStart = std::max(static_cast<int>(std::ceil(std::min(xLong, xShort))), 0);
+        const int xEnd = std::min(static_cast<int>(std::ceil(std::max(xLong, xShort))), width);
+        if (xStart >= xEnd)
         {
-            xStart = point1.x;
-            xEnd   = point2.x;
+            continue;
         }
-    }
-}
 
-///////////////////////////////////////////////////////////////////////////////
-// Draw a filled a triangle with a flat top
-///////////////////////////////////////////////////////////////////////////////
-//
-//  (x0,y0)------(x1,y1)
-//      \         /
-//       \       /
-//        \     /
-//         \   /
-//          \ /
-//        (x2,y2)
-//
-///////////////////////////////////////////////////////////////////////////////
-void drawFlatTopTriangle(ColorBufferArray& colorBuffer, Triangle& triangle, const size_t color)
-{
-    auto [point0, point1, point2] = triangle._points;
-    const float  MAX_WIDTH = std::abs(point1.x - point0.x);
-
-    float dy1 = point2.y - point0.y;
-    float dy2 = point2.y - point1.y;
-
-    if (std::abs(dy1) < EPSILON || std::abs(dy2) < EPSILON)
-        return;
-
-    float invSlop1 = (point2.x - point0.x) / dy1;
-    float invSlop2 = (point2.x - point1.x) / dy2;
+        const float rowReciprocalW = reciprocalW0 + (static_cast<float>(xStart) - v0.x) * reciprocalWStepX
+                                   + (rowY - v0.y) * reciprocalWStepY;
 
-    float xStart = std::round(point2.x);
-    float xEnd = std::round(point2.x);
-
-    for (int y = static_cast<int>(point2.y); y >= static_cast<int>(point0.y); y--)
-    {
-        drawLine(colorBuffer, {static_cast<int>(xStart), y}, {static_cast<int>(xEnd), y}, LineRasterAlgo::BRESENHAM, color);
-        xStart -= invSlop1;
-        xEnd -= invSlop2;
-
-        if (std::abs(xStart - xEnd) > MAX_WIDTH)
+        // Fragments that pass the depth test are collected into runs across tiles, each run is one fill
+        int runStart = xStart;
+        const auto writeRun = [&](const int runEnd)
         {
-            xStart = point0.x;
-            xEnd   = point1.x;
-        }
-    }
-}
+            colorBuffer.fillSpan(static_cast<size_t>(y), static_cast<size_t>(runStart), static_cast<size_t>(runEnd), color);
+        };
 
-void drawFilledTriangleFlatBottom(ColorBufferArray& colorBuffer, const Triangle& triangle, const size_t color)
-{
-    auto triangleSorted{triangle.sortByHeight()};
+        for (int x = xStart; x < xEnd;)
+        {
+            const size_t tileX = static_cast<size_t>(x) >> DEPTH_TILE_SHIFT;
+            const int tileEnd = std::min(static_cast<int>((tileX + 1) << DEPTH_TILE_SHIFT), xEnd);
 
-    if (std::abs(triangleSorted._points[1].y - triangleSorted._points[2].y) < EPSILON)
-    {
-        drawFlatBottomTriangle(colorBuffer, {triangleSorted}, color);
-        return;
-    }
+            const float reciprocalW = rowReciprocalW + static_cast<float>(x - xStart) * reciprocalWStepX;
+            const uint32_t passed = depthBuffer.testSpan(y, x, tileEnd, reciprocalW, reciprocalWStepX);
 
-    if (std::abs(triangleSorted._points[1].y - triangleSorted._points[0].y) < EPSILON)
-    {
-        drawFlatTopTriangle(colorBuffer, {triangleSorted}, color);
-        return;
+            const uint32_t allPassed = (1u << (tileEnd - x)) - 1u;
+            for (uint32_t failed = ~passed & allPassed; failed != 0u; failed &= failed - 1u)
+            {
+                const int failedX = x + std::countr_zero(failed);
+                writeRun(failedX);
+                runStart = failedX + 1;
+            }
+            x = tileEnd;
+        }
+        writeRun(xEnd);
     }
-
-    auto midPointOfTriangle {triangleSorted.getMidPoint()};
-
-    Triangle upTriangle{triangleSorted._points[0], triangleSorted._points[1], {midPointOfTriangle.x, midPointOfTriangle.y,0,0}};
-    Triangle bottomTriangle{triangleSorted._points[1], {midPointOfTriangle.x, midPointOfTriangle.y,0,0}, triangleSorted._points[2]};
-
-    drawFlatBottomTriangle(colorBuffer, upTriangle, color);
-    drawFlatTopTriangle(colorBuffer,bottomTriangle,color);
-
 }
 
-internal void drawTexel(ColorBufferArray& colorBuffer,
-                        Texture2dArray& texture,
-                        ZBufferArray& zBuffer,
+template <typename DepthFormat>
+internal void drawTexel(ColorBuffer& colorBuffer,
+                        const Texture2dArray& texture,
+                        DepthBuffer<DepthFormat>& depthBuffer,
                         const TriangleTextured& triangle,
                         int xCoord, int yCoord)
 {
@@ -321,10 +282,16 @@ internal void drawTexel(ColorBufferArray& colorBuffer,
     const auto& barycentricWeightsResult =  Math3D::BarycentricWeights({pointA.x, pointA.y}, {pointB.x, pointB.y}, {pointC.x, pointC.y},pointP);
     const auto& [alpha, beta, gama] = barycentricWeightsResult;
 
+    const float interpolatedReciprocalW = alpha * (1/ pointA.w) + beta * (1/ pointB.w) + gama * (1/ pointC.w);
+    const auto fragmentDepth = depthBuffer.encode(interpolatedReciprocalW);
+
+    // Early-Z: reject occluded fragments before any UV interpolation or texture fetch
+    if (!depthBuffer.passes(xCoord, yCoord, fragmentDepth)) {
+        return;
+    }
+
     float interpolatedU = (pointAUV.u / pointA.w) * alpha + (pointBUV.u / pointB.w) * beta + (pointCUV.u / pointC.w) * gama;
     float interpolatedV = (pointAUV.v / pointA.w) * alpha + (pointBUV.v / pointB.w) * beta + (pointCUV.v / pointC.w) * gama;
-    
-    const float interpolatedReciprocalW = alpha * (1/ pointA.w) + beta * (1/ pointB.w) + gama * (1/ pointC.w);
 
     interpolatedU /= interpolatedReciprocalW;
     interpolatedV /= interpolatedReciprocalW;
@@ -333,17 +300,11 @@ internal void drawTexel(ColorBufferArray& colorBuffer,
     const int texY = static_cast<int>(interpolatedV * static_cast<float>(texture.height - 1));
 
     const size_t texelIndex = static_cast<size_t>(texture.width * texY + texX);
-    const size_t pixelIndex = static_cast<size_t>(WINDOW_WIDTH * yCoord + xCoord);
-    const float cameraAdjustedInterpolatedReciprocalW = 1.0f - interpolatedReciprocalW;
-
-    if (pixelIndex >= zBuffer.size() || cameraAdjustedInterpolatedReciprocalW >= zBuffer[pixelIndex]) {
-        return;
-    }
 
     if (texelIndex < texture.data.size())
     {
         drawPixel(colorBuffer, xCoord, yCoord, texture.data[texelIndex]);
-        zBuffer[pixelIndex] =  cameraAdjustedInterpolatedReciprocalW;
+        depthBuffer.write(xCoord, yCoord, fragmentDepth);
     }
     else
     {
@@ -352,6 +313,47 @@ internal void drawTexel(ColorBufferArray& colorBuffer,
 
 }
 
+// Depth of the closest point of the triangle. 1/w is affine in screen space, so its extreme is at a vertex
+template <typename DepthFormat>
+internal auto nearestDepth(const TriangleTextured& triangle, const DepthBuffer<DepthFormat>& depthBuffer)
+{
+    const auto& [v0, v1, v2] = triangle._pointsWithUV;
+    return depthBuffer.encode(std::max({1.0f / v0.pos.w, 1.0f / v1.pos.w, 1.0f / v2.pos.w}));
+}
+
+// Walks one scanline span tile by tile, skipping every 8 pixel run whose tile is already closer than the triangle
+template <typename DepthFormat>
+internal void drawTexturedSpan(ColorBuffer& colorBuffer, const Texture2dArray& texture, DepthBuffer<DepthFormat>& depthBuffer,
+                               const TriangleTextured& triangle, const int y, int xStart, int xEnd,
+                               const typename DepthFormat::Storage triangleNearestDepth)
+{
+    if (y < 0 || y >= static_cast<int>(depthBuffer.height()))
+    {
+        return;
+    }
+
+    xStart = std::max(xStart, 0);
+    xEnd = std::min(xEnd, static_cast<int>(depthBuffer.width()));
+
+    const size_t tileY = static_cast<size_t>(y) >> DEPTH_TILE_SHIFT;
+    int x = xStart;
+    while (x < xEnd)
+    {
+        const size_t tileX = static_cast<size_t>(x) >> DEPTH_TILE_SHIFT;
+        const int tileEnd = std::min(static_cast<int>((tileX + 1) << DEPTH_TILE_SHIFT), xEnd);
+
+        if (!depthBuffer.isTileOccluded(tileX, tileY, triangleNearestDepth))
+        {
+            for (; x < tileEnd; x++)
+            {
+                drawTexel(colorBuffer, texture, depthBuffer, triangle, x, y);
+            }
+        }
+
+        x = tileEnd;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Draw a filled a triangle with a flat top with a texture
 ///////////////////////////////////////////////////////////////////////////////
@@ -365,7 +367,8 @@ internal void drawTexel(ColorBufferArray& colorBuffer,
 //        (x2,y2)
 //
 ///////////////////////////////////////////////////////////////////////////////
-void drawFlatTopTriangleTextured(ColorBufferArray& colorBuffer, Texture2dArray& texture, TriangleTextured& triangle, ZBufferArray& zBuffer)
+template <typename DepthFormat>
+void drawFlatTopTriangleTextured(ColorBuffer& colorBuffer, const Texture2dArray& texture, TriangleTextured& triangle, DepthBuffer<DepthFormat>& depthBuffer)
 {
     auto& vertices = triangle._pointsWithUV;
 
@@ -396,6 +399,7 @@ void drawFlatTopTriangleTextured(ColorBufferArray& colorBuffer, Texture2dArray&
 
     const int startY = static_cast<int>(std::ceil(v0.pos.y));
     const int endY = static_cast<int>(std::ceil(v2.pos.y));
+    const auto triangleNearestDepth = nearestDepth(triangle, depthBuffer);
 
     for (int y = startY; y < endY; y++)
     {
@@ -405,10 +409,7 @@ void drawFlatTopTriangleTextured(ColorBufferArray& colorBuffer, Texture2dArray&
         const int xStart = static_cast<int>(std::ceil(std::min(xLeft, xRight)));
         const int xEnd = static_cast<int>(std::ceil(std::max(xLeft, xRight)));
 
-        for (int x = xStart; x < xEnd; x++)
-        {
-            drawTexel(colorBuffer, texture, zBuffer, triangle, x, y);
-        }
+        drawTexturedSpan(colorBuffer, texture, depthBuffer, triangle, y, xStart, xEnd, triangleNearestDepth);
     }
 }
 
@@ -425,7 +426,8 @@ void drawFlatTopTriangleTextured(ColorBufferArray& colorBuffer, Texture2dArray&
 //  (x1,y1)------(x2,y2)
 //
 ///////////////////////////////////////////////////////////////////////////////
-void drawFlatBottomTriangleTextured(ColorBufferArray& colorBuffer, Texture2dArray& texture, TriangleTextured &triangle, ZBufferArray& zBuffer)
+template <typename DepthFormat>
+void drawFlatBottomTriangleTextured(ColorBuffer& colorBuffer, const Texture2dArray& texture, TriangleTextured& triangle, DepthBuffer<DepthFormat>& depthBuffer)
 {
     auto& vertices = triangle._pointsWithUV;
 
@@ -456,28 +458,38 @@ void drawFlatBottomTriangleTextured(ColorBufferArray& colorBuffer, Texture2dArra
 
     const int startY = static_cast<int>(std::ceil(v0.pos.y));
     const int endY = static_cast<int>(std::ceil(v1.pos.y));
+    const auto triangleNearestDepth = nearestDepth(triangle, depthBuffer);
 
     for (int y = startY; y < endY; y++)
     {
         float xLeft = v0.pos.x + (y - v0.pos.y) * invSlopeLeft;
         float xRight = v0.pos.x + (y - v0.pos.y) * invSlopeRight;
 
-        int xStart = static_cast<int>(std::ceil(std::min(xLeft, xRight)));
-        int xEnd = static_cast<int>(std::ceil(std::max(xLeft, xRight)));
+        const int xStart = static_cast<int>(std::ceil(std::min(xLeft, xRight)));
+        const int xEnd = static_cast<int>(std::ceil(std::max(xLeft, xRight)));
 
-        for (int x = xStart; x < xEnd; x++)
-        {
-            drawTexel(colorBuffer, texture, zBuffer, triangle, x, y);
-        }
+        drawTexturedSpan(colorBuffer, texture, depthBuffer, triangle, y, xStart, xEnd, triangleNearestDepth);
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Main triangle drawing function with proper triangle splitting
 ///////////////////////////////////////////////////////////////////////////////
-void drawTexturedTriangle(ColorBufferArray& colorBuffer, const Triangle& triangle, Texture2dArray& texture, ZBufferArray& zBuffer)
+template <typename DepthFormat>
+void drawTexturedTriangle(ColorBuffer& colorBuffer, const Triangle& triangle, const Texture2dArray& texture, DepthBuffer<DepthFormat>& depthBuffer)
 {
     const TriangleTextured triangleTextured{triangle};
+
+    // Coarse rejection: skip the whole triangle when every tile under its bounding box is closer
+    const auto& [p0, p1, p2] = triangle._points;
+    const int minX = static_cast<int>(std::floor(std::min({p0.x, p1.x, p2.x})));
+    const int minY = static_cast<int>(std::floor(std::min({p0.y, p1.y, p2.y})));
+    const int maxX = static_cast<int>(std::ceil(std::max({p0.x, p1.x, p2.x}))) + 1;
+    const int maxY = static_cast<int>(std::ceil(std::max({p0.y, p1.y, p2.y}))) + 1;
+    if (depthBuffer.isRectOccluded(minX, minY, maxX, maxY, nearestDepth(triangleTextured, depthBuffer)))
+    {
+        return;
+    }
     auto vertices = triangleTextured._pointsWithUV; // Make a copy for sorting
 
     // Sort vertices by y-coordinate (ascending)
@@ -497,7 +509,7 @@ void drawTexturedTriangle(ColorBufferArray& colorBuffer, const Triangle& triangl
     {
         TriangleTextured flatBottomTri;
         flatBottomTri._pointsWithUV = {v0, v1, v2};
-        drawFlatBottomTriangleTextured(colorBuffer, texture, flatBottomTri, zBuffer);
+        drawFlatBottomTriangleTextured(colorBuffer, texture, flatBottomTri, depthBuffer);
         return;
     }
 
@@ -505,7 +517,7 @@ void drawTexturedTriangle(ColorBufferArray& colorBuffer, const Triangle& triangl
     {
         TriangleTextured flatTopTri;
         flatTopTri._pointsWithUV = {v0, v1, v2};
-        drawFlatTopTriangleTextured(colorBuffer, texture, flatTopTri, zBuffer);
+        drawFlatTopTriangleTextured(colorBuffer, texture, flatTopTri, depthBuffer);
         return;
     }
 
@@ -544,12 +556,23 @@ void drawTexturedTriangle(ColorBufferArray& colorBuffer, const Triangle& triangl
     // Top vertex: v0, Bottom edge: v1 and splitVertex
     TriangleTextured upperTri;
     upperTri._pointsWithUV = {v0, v1, splitVertex};
-    drawFlatBottomTriangleTextured(colorBuffer, texture, upperTri, zBuffer);
+    drawFlatBottomTriangleTextured(colorBuffer, texture, upperTri, depthBuffer);
 
     // Draw lower triangle (flat-top)
     // Top edge: v1 and splitVertex, Bottom vertex: v2
     TriangleTextured lowerTri;
     lowerTri._pointsWithUV = {v1, splitVertex, v2};
-    drawFlatTopTriangleTextured(colorBuffer, texture, lowerTri, zBuffer);
+    drawFlatTopTriangleTextured(colorBuffer, texture, lowerTri, depthBuffer);
 }
+
+template void drawFlatTriangle(ColorBuffer&, const Triangle&, uint32_t, DepthBuffer<FloatDepth>&);
+template void drawFlatTriangle(ColorBuffer&, const Triangle&, uint32_t, DepthBuffer<ReversedFloatDepth>&);
+template void drawFlatTriangle(ColorBuffer&, const Triangle&, uint32_t, DepthBuffer<Unorm16Depth>&);
+template void drawFlatTriangle(ColorBuffer&, const Triangle&, uint32_t, DepthBuffer<Unorm24Depth>&);
+
+template void drawTexturedTriangle(ColorBuffer&, const Triangle&, const Texture2dArray&, DepthBuffer<FloatDepth>&);
+template void drawTexturedTriangle(ColorBuffer&, const Triangle&, const Texture2dArray&, DepthBuffer<ReversedFloatDepth>&);
+template void drawTexturedTriangle(ColorBuffer&, const Triangle&, const Texture2dArray&, DepthBuffer<Unorm16Depth>&);
+template void drawTexturedTriangle(ColorBuffer&, const Triangle&, const Texture2dArray&, DepthBuffer<Unorm24Depth>&);
+
 }
@@ -0,0 +1,70 @@
+#include "graphics/rendering/inc/DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr float COST_SMOOTHING = 0.2f;   // Weight of the newest frame in the running average
+    constexpr float HEADROOM = 0.9f;         // Aim below the target so a noisy frame does not miss it
+    constexpr float MAX_STEP = 0.1f;         // Largest relative scale change per frame
+    constexpr float MIN_STEP = 0.02f;        // Smaller corrections are not worth a resize
+    constexpr size_t GRANULARITY = 8u;       // Keep whole 8x8 tiles
+}
+
+namespace Render
+{
+
+DynamicResolution::DynamicResolution(const float targetFrameMs, const float minScale, const float maxScale)
+    : _targetFrameMs(targetFrameMs)
+    , _minScale(minScale)
+    , _maxScale(maxScale)
+    , _scale(maxScale)
+{
+}
+
+float DynamicResolution::update(const float frameCostMs)
+{
+    _averageCostMs = _hasSample ? _averageCostMs + COST_SMOOTHING * (frameCostMs - _averageCostMs) : frameCostMs;
+    _hasSample = true;
+
+    if (_averageCostMs <= 0.0f)
+    {
+        return _scale;
+    }
+
+    const float idealScale = _scale * std::sqrt(_targetFrameMs * HEADROOM / _averageCostMs);
+    const float steppedScale = std::clamp(idealScale, _scale * (1.0f - MAX_STEP), _scale * (1.0f + MAX_STEP));
+    const float nextScale = std::clamp(steppedScale, _minScale, _maxScale);
+
+    if (std::abs(nextScale - _scale) < MIN_STEP * _scale)
+    {
+        return _scale;
+    }
+
+    // Rescale the history to the new pixel count so the next prediction starts from the right cost
+    const float ratio = nextScale / _scale;
+    _averageCostMs *= ratio * ratio;
+    _scale = nextScale;
+    return _scale;
+}
+
+void DynamicResolution::reset()
+{
+    _scale = _maxScale;
+    _averageCostMs = 0.0f;
+    _hasSample = false;
+}
+
+size_t DynamicResolution::scaleDimension(const size_t fullSize, const float scale)
+{
+    if (scale >= 1.0f)
+    {
+        return fullSize;
+    }
+
+    const auto scaled = static_cast<size_t>(std::lround(static_cast<float>(fullSize) * scale / GRANULARITY)) * GRANULARITY;
+    return std::clamp(scaled, std::min(GRANULARITY, fullSize), fullSize);
+}
+
+}
@@ -0,0 +1,281 @@
+#include "graphics/rendering/inc/LineRasterizer.h"
+
+#include "graphics/rendering/inc/DepthBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    // Steps of the depth format an overlay line is moved towards the camera by on top of its slope,
+    // for the rounding between an edge and the fill under it
+    constexpr uint32_t OVERLAY_DEPTH_STEPS = 4u;
+
+    // Coverage in fixed point, 256 is the line color and 0 leaves the pixel as it is
+    constexpr float FULL_COVERAGE = 256.0f;
+
+    Render::LineVertex lerp(const Render::LineVertex& start, const Render::LineVertex& end, const float t)
+    {
+        return {start.x + (end.x - start.x) * t, start.y + (end.y - start.y) * t,
+                start.reciprocalW + (end.reciprocalW - start.reciprocalW) * t};
+    }
+
+    // Liang-Barsky: shrinks the segment to the part inside [0, maxX] x [0, maxY], false when none is left
+    bool clipSegment(Render::LineVertex& start, Render::LineVertex& end, const float maxX, const float maxY)
+    {
+        if (!std::isfinite(start.x) || !std::isfinite(start.y) || !std::isfinite(end.x) || !std::isfinite(end.y))
+        {
+            return false;
+        }
+
+        const float deltaX = end.x - start.x;
+        const float deltaY = end.y - start.y;
+        const std::array<float, 4> direction{-deltaX, deltaX, -deltaY, deltaY};
+        const std::array<float, 4> distance{start.x, maxX - start.x, start.y, maxY - start.y};
+
+        float tEnter{0.0f};
+        float tExit{1.0f};
+        for (size_t edge = 0; edge < direction.size(); ++edge)
+        {
+            if (direction[edge] == 0.0f)
+            {
+                // Parallel to this boundary: entirely outside it or not limited by it
+                if (distance[edge] < 0.0f)
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            const float t = distance[edge] / direction[edge];
+            if (direction[edge] < 0.0f)
+            {
+                tEnter = std::max(tEnter, t);
+            }
+            else
+            {
+                tExit = std::min(tExit, t);
+            }
+        }
+
+        if (tEnter > tExit)
+        {
+            return false;
+        }
+
+        const Render::LineVertex clippedStart = lerp(start, end, tEnter);
+        end = lerp(start, end, tExit);
+        start = clippedStart;
+        return true;
+    }
+
+    // Clips and rounds the segment, then calls plot(x, y, reciprocalW) for every pixel from start to end
+    template <typename Plot>
+    void walkLine(const size_t width, const size_t height, Render::LineVertex start, Render::LineVertex end,
+                  Plot&& plot)
+    {
+        if (width == 0u || height == 0u)
+        {
+            return;
+        }
+
+        const auto maxX = static_cast<int>(width) - 1;
+        const auto maxY = static_cast<int>(height) - 1;
+        if (!clipSegment(start, end, static_cast<float>(maxX), static_cast<float>(maxY)))
+        {
+            return;
+        }
+
+        // The clipped ends can land a rounding error outside the buffer, the clamp keeps every step inside
+        int x = std::clamp(static_cast<int>(std::lround(start.x)), 0, maxX);
+        int y = std::clamp(static_cast<int>(std::lround(start.y)), 0, maxY);
+        const int endX = std::clamp(static_cast<int>(std::lround(end.x)), 0, maxX);
+        const int endY = std::clamp(static_cast<int>(std::lround(end.y)), 0, maxY);
+
+        const int deltaX = std::abs(endX - x);
+        const int deltaY = -std::abs(endY - y);
+        const int stepX = x < endX ? 1 : -1;
+        const int stepY = y < endY ? 1 : -1;
+
+        const int steps = std::max(deltaX, -deltaY);
+        const float reciprocalWStep = steps > 0 ? (end.reciprocalW - start.reciprocalW) / static_cast<float>(steps) : 0.0f;
+        float reciprocalW = start.reciprocalW;
+
+        int error = deltaX + deltaY;
+        for (int step = 0; step <= steps; ++step, reciprocalW += reciprocalWStep)
+        {
+            plot(static_cast<size_t>(x), static_cast<size_t>(y), reciprocalW);
+
+            const int doubledError = 2 * error;
+            if (doubledError >= deltaY)
+            {
+                error += deltaY;
+                x += stepX;
+            }
+            if (doubledError <= deltaX)
+            {
+                error += deltaX;
+                y += stepY;
+            }
+        }
+    }
+
+    // pixel + (color - pixel) * coverage / 256 for every channel of two pixels. Their eight channels widen
+    // to 16 bits in one SSE register; the two weights of a channel add up to 256, so the sum stays below 2^16.
+    void blendPair(uint32_t& first, uint32_t& second, const uint32_t color, const uint32_t firstCoverage,
+                   const uint32_t secondCoverage)
+    {
+#if defined(__SSE2__)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i pixels = _mm_unpacklo_epi32(_mm_cvtsi32_si128(static_cast<int>(first)),
+                                                  _mm_cvtsi32_si128(static_cast<int>(second)));
+        const __m128i destination = _mm_unpacklo_epi8(pixels, zero);
+        const __m128i source = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(color)), zero);
+
+        const __m128i coverage = _mm_unpacklo_epi64(_mm_set1_epi16(static_cast<short>(firstCoverage)),
+                                                    _mm_set1_epi16(static_cast<short>(secondCoverage)));
+        const __m128i remaining = _mm_sub_epi16(_mm_set1_epi16(static_cast<short>(FULL_COVERAGE)), coverage);
+
+        const __m128i blended = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(source, coverage),
+                                                             _mm_mullo_epi16(destination, remaining)), 8);
+        const __m128i packed = _mm_packus_epi16(blended, blended);
+        first = static_cast<uint32_t>(_mm_cvtsi128_si32(packed));
+        second = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(packed, 4)));
+#else
+        const auto blend = [color](const uint32_t pixel, const uint32_t coverage)
+        {
+            uint32_t result{0};
+            for (uint32_t shift = 0; shift < 32u; shift += 8u)
+            {
+                const uint32_t source = (color >> shift) & 0xFFu;
+                const uint32_t destination = (pixel >> shift) & 0xFFu;
+                result |= ((source * coverage + destination * (256u - coverage)) >> 8u) << shift;
+            }
+            return result;
+        };
+        first = blend(first, firstCoverage);
+        second = blend(second, secondCoverage);
+#endif
+    }
+
+    // Wu's walk over a segment already clipped to [0, maxX] x [0, maxY]. Steep lines swap the axes, so the
+    // walk always advances one column of the major axis and the pair is stacked along the minor one.
+    void walkAntialiasedLine(Render::ColorBuffer& colorBuffer, const Render::LineVertex& start,
+                             const Render::LineVertex& end, const uint32_t color, const int maxX, const int maxY)
+    {
+        const bool isSteep = std::abs(end.y - start.y) > std::abs(end.x - start.x);
+        float major0 = isSteep ? start.y : start.x;
+        float minor0 = isSteep ? start.x : start.y;
+        float major1 = isSteep ? end.y : end.x;
+        float minor1 = isSteep ? end.x : end.y;
+        if (major0 > major1)
+        {
+            std::swap(major0, major1);
+            std::swap(minor0, minor1);
+        }
+
+        const int maxMajor = isSteep ? maxY : maxX;
+        const int maxMinor = isSteep ? maxX : maxY;
+        const float deltaMajor = major1 - major0;
+        const float gradient = deltaMajor > 0.0f ? (minor1 - minor0) / deltaMajor : 0.0f;
+
+        // Pixels of the pair that fall off the buffer, which the ends and the rounding can push them to, blend into this
+        uint32_t offscreen{0};
+        const auto plot = [&](const int major, const float minor, const float weight)
+        {
+            const float lowMinor = std::floor(minor);
+            const float fraction = minor - lowMinor;
+            const auto low = static_cast<int>(lowMinor);
+            const auto pixelAt = [&](const int at) -> uint32_t&
+            {
+                if (at < 0 || at > maxMinor)
+                {
+                    return offscreen;
+                }
+                return isSteep ? colorBuffer.pixel(static_cast<size_t>(at), static_cast<size_t>(major))
+                               : colorBuffer.pixel(static_cast<size_t>(major), static_cast<size_t>(at));
+            };
+
+            const float coverage = weight * FULL_COVERAGE;
+            blendPair(pixelAt(low), pixelAt(low + 1), color, static_cast<uint32_t>((1.0f - fraction) * coverage + 0.5f),
+                      static_cast<uint32_t>(fraction * coverage + 0.5f));
+        };
+
+        // Each end covers its column by how far the segment reaches past the pixel center
+        const int firstMajor = std::clamp(static_cast<int>(std::floor(major0 + 0.5f)), 0, maxMajor);
+        const float firstMinor = minor0 + gradient * (static_cast<float>(firstMajor) - major0);
+        plot(firstMajor, firstMinor, static_cast<float>(firstMajor) + 0.5f - major0);
+
+        const int lastMajor = std::clamp(static_cast<int>(std::floor(major1 + 0.5f)), 0, maxMajor);
+        if (lastMajor == firstMajor)
+        {
+            return;
+        }
+        const float lastMinor = minor1 + gradient * (static_cast<float>(lastMajor) - major1);
+        plot(lastMajor, lastMinor, major1 - (static_cast<float>(lastMajor) - 0.5f));
+
+        float minor = firstMinor + gradient;
+        for (int major = firstMajor + 1; major < lastMajor; ++major, minor += gradient)
+        {
+            plot(major, minor, 1.0f);
+        }
+    }
+}
+
+namespace Render
+{
+
+void drawWireLine(ColorBuffer& colorBuffer, const LineVertex start, const LineVertex end, const uint32_t color)
+{
+    walkLine(colorBuffer.width(), colorBuffer.height(), start, end,
+             [&colorBuffer, color](const size_t x, const size_t y, float)
+             {
+                 colorBuffer.write(x, y, color);
+             });
+}
+
+template <typename DepthFormat>
+void drawWireLine(ColorBuffer& colorBuffer, const LineVertex start, const LineVertex end, const uint32_t color,
+                  const float reciprocalWSlope, const DepthBuffer<DepthFormat>& depthBuffer)
+{
+    const float slopeOffset = 0.5f * reciprocalWSlope;
+    walkLine(std::min(colorBuffer.width(), depthBuffer.width()), std::min(colorBuffer.height(), depthBuffer.height()),
+             start, end,
+             [&colorBuffer, &depthBuffer, color, slopeOffset](const size_t x, const size_t y, const float reciprocalW)
+             {
+                 const auto depth = DepthFormat::nearer(depthBuffer.encode(reciprocalW + slopeOffset), OVERLAY_DEPTH_STEPS);
+                 if (depthBuffer.passes(x, y, depth))
+                 {
+                     colorBuffer.write(x, y, color);
+                 }
+             });
+}
+
+void drawWireLineAntialiased(ColorBuffer& colorBuffer, LineVertex start, LineVertex end, const uint32_t color)
+{
+    if (colorBuffer.width() == 0u || colorBuffer.height() == 0u)
+    {
+        return;
+    }
+
+    const auto maxX = static_cast<int>(colorBuffer.width()) - 1;
+    const auto maxY = static_cast<int>(colorBuffer.height()) - 1;
+    if (clipSegment(start, end, static_cast<float>(maxX), static_cast<float>(maxY)))
+    {
+        walkAntialiasedLine(colorBuffer, start, end, color, maxX, maxY);
+    }
+}
+
+template void drawWireLine(ColorBuffer&, LineVertex, LineVertex, uint32_t, float, const DepthBuffer<FloatDepth>&);
+template void drawWireLine(ColorBuffer&, LineVertex, LineVertex, uint32_t, float, const DepthBuffer<ReversedFloatDepth>&);
+template void drawWireLine(ColorBuffer&, LineVertex, LineVertex, uint32_t, float, const DepthBuffer<Unorm16Depth>&);
+template void drawWireLine(ColorBuffer&, LineVertex, LineVertex, uint32_t, float, const DepthBuffer<Unorm24Depth>&);
+
+}
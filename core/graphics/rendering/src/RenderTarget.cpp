@@ -0,0 +1,55 @@
+#include "graphics/rendering/inc/RenderTarget.h"
+
+#include <variant>
+
+namespace Render
+{
+
+RenderTarget::RenderTarget(const size_t width, const size_t height, const DepthFormat depthFormat, const DepthRange depthRange)
+    : _depthFormat(depthFormat)
+    , _depthRange(depthRange)
+    , _color(width, height)
+    , _depth(makeDepthBuffer(depthFormat, width, height, depthRange))
+{
+}
+
+void RenderTarget::setDepthFormat(const DepthFormat depthFormat)
+{
+    if (depthFormat != _depthFormat)
+    {
+        _depthFormat = depthFormat;
+        _depth = makeDepthBuffer(_depthFormat, capacityWidth(), capacityHeight(), _depthRange);
+        std::visit([this](auto& depthBuffer) { depthBuffer.setSize(width(), height()); }, _depth);
+    }
+}
+
+void RenderTarget::resize(const size_t width, const size_t height)
+{
+    if (width == capacityWidth() && height == capacityHeight())
+    {
+        setRenderSize(width, height);
+        return;
+    }
+
+    _color = ColorBuffer{width, height};
+    _depth = makeDepthBuffer(_depthFormat, width, height, _depthRange);
+}
+
+void RenderTarget::setRenderSize(const size_t width, const size_t height)
+{
+    if (width == this->width() && height == this->height())
+    {
+        return;
+    }
+
+    _color.setSize(width, height);
+    std::visit([width, height](auto& depthBuffer) { depthBuffer.setSize(width, height); }, _depth);
+}
+
+void RenderTarget::clear()
+{
+    _color.clear();
+    std::visit([](auto& depthBuffer) { depthBuffer.clear(); }, _depth);
+}
+
+}
@@ -0,0 +1,91 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <graphics/rendering/inc/ColorBuffer.h>
+#include <utils/inc/ThreadPool.h>
+
+#include "doctest/doctest.h"
+
+namespace
+{
+    constexpr uint32_t CLEAR_COLOR = 0x000000FFu;
+    constexpr uint32_t STALE_COLOR = 0xDEADBEEFu;
+    constexpr uint32_t DRAWN_COLOR = 0x12345678u;
+
+    // Clears a buffer that still holds a full stale frame, draws one pixel and resolves
+    void checkLazyClear(Utils::ThreadPool* threadPool)
+    {
+        // Odd sizes leave partial tiles on the right and bottom edges
+        Render::ColorBuffer colorBuffer{37u, 21u, CLEAR_COLOR};
+        colorBuffer.fill(STALE_COLOR);
+        colorBuffer.clear();
+
+        CHECK(colorBuffer.at(5u, 5u) == CLEAR_COLOR);
+
+        colorBuffer.write(9u, 3u, DRAWN_COLOR);
+        colorBuffer.fillSpan(20u, 30u, 37u, DRAWN_COLOR);
+        colorBuffer.resolve(threadPool);
+
+        const size_t stride = colorBuffer.pitch() / sizeof(uint32_t);
+        const uint32_t* pixels = colorBuffer.data();
+        size_t drawnCount = 0;
+        size_t clearCount = 0;
+        for (size_t y = 0; y < colorBuffer.height(); ++y)
+        {
+            for (size_t x = 0; x < colorBuffer.width(); ++x)
+            {
+                drawnCount += pixels[y * stride + x] == DRAWN_COLOR;
+                clearCount += pixels[y * stride + x] == CLEAR_COLOR;
+            }
+        }
+
+        CHECK(stride >= colorBuffer.width());
+        CHECK(pixels[3u * stride + 9u] == DRAWN_COLOR);
+        CHECK(pixels[20u * stride + 36u] == DRAWN_COLOR);
+        CHECK(drawnCount == 8u);
+        CHECK(clearCount == colorBuffer.width() * colorBuffer.height() - 8u);
+    }
+}
+
+TEST_CASE("Cleared tiles are filled on first write and on resolve")
+{
+    checkLazyClear(nullptr);
+}
+
+TEST_CASE("Parallel resolve fills every untouched tile")
+{
+    Utils::ThreadPool threadPool{4u};
+    checkLazyClear(&threadPool);
+}
+
+TEST_CASE("An attached buffer resolves the whole frame into external memory within its pitch")
+{
+    Render::ColorBuffer colorBuffer{37u, 21u, CLEAR_COLOR};
+
+    // Pitch wider than the frame, like a locked texture row; the padding must never be written
+    constexpr size_t externalStride = 45u;
+    std::vector<uint32_t> external(externalStride * colorBuffer.height(), STALE_COLOR);
+    colorBuffer.attach(external.data(), externalStride * sizeof(uint32_t));
+
+    CHECK(colorBuffer.data() == external.data());
+    colorBuffer.write(9u, 3u, DRAWN_COLOR);
+    colorBuffer.resolve();
+    colorBuffer.detach();
+
+    size_t clearCount = 0;
+    for (size_t y = 0; y < colorBuffer.height(); ++y)
+    {
+        for (size_t x = 0; x < externalStride; ++x)
+        {
+            const uint32_t pixel = external[y * externalStride + x];
+            if (x >= colorBuffer.width())
+            {
+                CHECK(pixel == STALE_COLOR);
+            }
+            clearCount += pixel == CLEAR_COLOR;
+        }
+    }
+
+    CHECK(external[3u * externalStride + 9u] == DRAWN_COLOR);
+    CHECK(clearCount == colorBuffer.width() * colorBuffer.height() - 1u);
+    CHECK(colorBuffer.data() != external.data());
+}
@@ -0,0 +1,111 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <graphics/rendering/inc/DepthBuffer.h>
+
+#include "doctest/doctest.h"
+
+TEST_CASE_TEMPLATE("Nearer fragments encode nearer for every format", Format,
+                   Render::FloatDepth, Render::ReversedFloatDepth, Render::Unorm16Depth, Render::Unorm24Depth)
+{
+    const Render::DepthRange range{0.1f, 100.0f};
+    const float viewDistances[] = {0.1f, 0.5f, 2.0f, 4.0f, 4.01f, 20.0f, 99.0f};
+
+    for (size_t i = 1; i < std::size(viewDistances); ++i)
+    {
+        const auto nearer = Format::encode(1.0f / viewDistances[i - 1], range);
+        const auto farther = Format::encode(1.0f / viewDistances[i], range);
+        CHECK(Format::isNearer(nearer, farther));
+        CHECK(Format::isNearer(farther, Format::CLEAR));
+    }
+}
+
+TEST_CASE_TEMPLATE("Tile occlusion follows written depth", Format,
+                   Render::FloatDepth, Render::ReversedFloatDepth, Render::Unorm16Depth, Render::Unorm24Depth)
+{
+    Render::DepthBuffer<Format> depthBuffer{20u, 12u};
+    const auto nearDepth = depthBuffer.encode(1.0f / 2.0f);
+    const auto farDepth = depthBuffer.encode(1.0f / 8.0f);
+
+    CHECK_FALSE(depthBuffer.isTileOccluded(0u, 0u, farDepth));
+
+    for (size_t y = 0; y < Render::DEPTH_TILE_SIZE; ++y)
+    {
+        for (size_t x = 0; x < Render::DEPTH_TILE_SIZE; ++x)
+        {
+            depthBuffer.write(x, y, nearDepth);
+        }
+    }
+
+    CHECK(depthBuffer.isRectOccluded(0, 0, 8, 8, farDepth));
+    CHECK(depthBuffer.isTileOccluded(0u, 0u, farDepth));
+    CHECK_FALSE(depthBuffer.isRectOccluded(0, 0, 9, 8, farDepth));
+    CHECK_FALSE(depthBuffer.passes(3u, 3u, farDepth));
+
+    depthBuffer.clear();
+    CHECK(depthBuffer.passes(3u, 3u, farDepth));
+    CHECK_FALSE(depthBuffer.isTileOccluded(0u, 0u, farDepth));
+
+    // The first write into a cleared tile must not resurrect the previous frame's depth
+    depthBuffer.write(3u, 3u, farDepth);
+    CHECK(depthBuffer.at(4u, 4u) == Format::CLEAR);
+    CHECK_FALSE(depthBuffer.passes(3u, 3u, farDepth));
+}
+
+TEST_CASE_TEMPLATE("Dirty tiles are refreshed per rectangle and read conservatively in between", Format,
+                   Render::FloatDepth, Render::ReversedFloatDepth, Render::Unorm16Depth, Render::Unorm24Depth)
+{
+    // 20x12: the right column and the bottom row of tiles are partial
+    Render::DepthBuffer<Format> depthBuffer{20u, 12u};
+    depthBuffer.clear();
+    const auto nearDepth = depthBuffer.encode(1.0f / 2.0f);
+    const auto middleDepth = depthBuffer.encode(1.0f / 4.0f);
+    const auto farDepth = depthBuffer.encode(1.0f / 8.0f);
+
+    // Every pixel of the partial corner tile near but one
+    for (size_t y = 8; y < 12u; ++y)
+    {
+        CHECK(depthBuffer.testSpan(y, 16u, 20u, 1.0f / 2.0f, 0.0f) == 0xFu);
+    }
+    depthBuffer.write(19u, 11u, farDepth);
+
+    CHECK_FALSE(depthBuffer.isRectOccluded(16, 8, 20, 12, middleDepth));
+    CHECK_FALSE(depthBuffer.isTileOccluded(2u, 1u, middleDepth));
+
+    // The last pixel brought near dirties the tile; until a rectangle refreshes it, the tile keeps its
+    // farther depth and still lets the middle depth through
+    depthBuffer.write(19u, 11u, nearDepth);
+    CHECK_FALSE(depthBuffer.isTileOccluded(2u, 1u, middleDepth));
+    CHECK(depthBuffer.isRectOccluded(16, 8, 40, 40, middleDepth));
+    CHECK(depthBuffer.isTileOccluded(2u, 1u, middleDepth));
+    CHECK_FALSE(depthBuffer.isTileOccluded(2u, 1u, depthBuffer.encode(1.0f)));
+
+    // A rectangle reaching into an untouched tile is not occluded, but still refreshes every dirty tile it covers
+    depthBuffer.write(0u, 0u, nearDepth);
+    CHECK_FALSE(depthBuffer.isRectOccluded(0, 0, 20, 12, middleDepth));
+    CHECK(depthBuffer.isTileOccluded(2u, 1u, middleDepth));
+    CHECK_FALSE(depthBuffer.isTileOccluded(0u, 0u, middleDepth));
+
+    // Rectangles entirely off the buffer have nothing to draw
+    CHECK(depthBuffer.isRectOccluded(-10, -10, 0, 5, farDepth));
+}
+
+TEST_CASE_TEMPLATE("Span test writes and reports only the nearer fragments", Format,
+                   Render::FloatDepth, Render::ReversedFloatDepth, Render::Unorm16Depth, Render::Unorm24Depth)
+{
+    Render::DepthBuffer<Format> depthBuffer{20u, 12u};
+    depthBuffer.clear();
+
+    // Everything passes against a cleared tile
+    CHECK(depthBuffer.testSpan(2u, 8u, 16u, 1.0f / 4.0f, 0.0f) == 0xFFu);
+    CHECK(depthBuffer.at(8u, 2u) == depthBuffer.encode(1.0f / 4.0f));
+    CHECK(depthBuffer.isTileOccluded(1u, 0u, depthBuffer.encode(1.0f / 8.0f)) == false);
+
+    // 1/w growing along the span: the far left half fails against distance 4, the near right half passes
+    const uint32_t passed = depthBuffer.testSpan(2u, 8u, 16u, 1.0f / 8.0f, 0.04f);
+    CHECK(passed == 0xF0u);
+    CHECK(depthBuffer.at(11u, 2u) == depthBuffer.encode(1.0f / 4.0f));
+    CHECK(Format::isNearer(depthBuffer.at(15u, 2u), depthBuffer.encode(1.0f / 4.0f)));
+
+    // Partial spans keep their bits relative to x0
+    CHECK(depthBuffer.testSpan(5u, 3u, 6u, 1.0f / 2.0f, 0.0f) == 0x7u);
+}
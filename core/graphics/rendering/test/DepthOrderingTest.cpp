@@ -0,0 +1,68 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <graphics/pipeline/inc/RasterStage.h>
+#include <graphics/rendering/inc/DepthOrdering.h>
+#include <graphics/shapes/inc/Triangle.h>
+
+#include "doctest/doctest.h"
+
+#include <vector>
+
+namespace
+{
+    // Average depths out of order, the nearest is index 1 and the farthest index 2
+    std::vector<Triangle> makeTriangles()
+    {
+        std::vector<Triangle> triangles(4u);
+        const float depths[] = {5.0f, 1.0f, 9.0f, 3.0f};
+        for (size_t i = 0; i < triangles.size(); ++i)
+        {
+            triangles[i].setAvgDepth(depths[i]);
+        }
+        return triangles;
+    }
+}
+
+TEST_CASE("Triangles are ordered by average depth either way")
+{
+    const auto triangles = makeTriangles();
+    Render::TriangleSorter sorter;
+
+    CHECK(sorter.sort(triangles, Render::DepthOrder::FRONT_TO_BACK) == std::vector<uint32_t>{1u, 3u, 0u, 2u});
+    CHECK(sorter.sort(triangles, Render::DepthOrder::BACK_TO_FRONT) == std::vector<uint32_t>{2u, 0u, 3u, 1u});
+}
+
+TEST_CASE("Triangles drawn in no particular order are not sorted")
+{
+    const auto triangles = makeTriangles();
+    Render::TriangleSorter sorter;
+
+    // Nothing is left over from the frame before either
+    sorter.sort(triangles, Render::DepthOrder::FRONT_TO_BACK);
+    CHECK(sorter.sort(triangles, Render::DepthOrder::NONE).empty());
+    CHECK(sorter.drawOrder().empty());
+}
+
+TEST_CASE("Every rendering state draws in the order its depth testing needs")
+{
+    using enum Render::RenderingStates;
+    constexpr auto FRONT_TO_BACK = Render::DepthOrder::FRONT_TO_BACK;
+    constexpr auto BACK_TO_FRONT = Render::DepthOrder::BACK_TO_FRONT;
+    constexpr auto UNSORTED = Render::DepthOrder::NONE;
+
+    // Only fills are drawn in sorted order, lines and dots on their own need none
+    CHECK(Render::drawOrder(WIREFRAME_WITH_VERTICES) == UNSORTED);
+    CHECK(Render::drawOrder(WIREFRAME_ONLY) == UNSORTED);
+    CHECK(Render::drawOrder(ANTIALIASED_WIREFRAME) == UNSORTED);
+
+    // Fills are depth tested, and so is the wireframe drawn over them
+    CHECK(Render::drawOrder(FILLED_TRIANGLES) == FRONT_TO_BACK);
+    CHECK(Render::drawOrder(FILLED_TRIANGLES_WITH_WIREFRAME) == FRONT_TO_BACK);
+    CHECK(Render::drawOrder(TEXTURED_TRIANGLES) == FRONT_TO_BACK);
+    CHECK(Render::drawOrder(TEXTURED_TRIANGLES_WITH_WIREFRAME) == FRONT_TO_BACK);
+
+    // Early-Z ordering switched off falls back to the painter's order for the fills only
+    CHECK(Render::drawOrder(TEXTURED_TRIANGLES, false) == BACK_TO_FRONT);
+    CHECK(Render::drawOrder(FILLED_TRIANGLES_WITH_WIREFRAME, false) == BACK_TO_FRONT);
+    CHECK(Render::drawOrder(ANTIALIASED_WIREFRAME, false) == UNSORTED);
+}
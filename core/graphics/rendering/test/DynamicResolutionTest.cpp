@@ -0,0 +1,63 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <graphics/rendering/inc/DynamicResolution.h>
+
+#include "doctest/doctest.h"
+
+TEST_CASE("Scale drops while frames blow the budget and stops at the minimum")
+{
+    Render::DynamicResolution dynamicResolution{16.0f, 0.5f, 1.0f};
+
+    float previousScale = dynamicResolution.scale();
+    for (int frame = 0; frame < 5; ++frame)
+    {
+        const float scale = dynamicResolution.update(40.0f);
+        CHECK(scale < previousScale);
+        previousScale = scale;
+    }
+
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        dynamicResolution.update(40.0f);
+    }
+    CHECK(dynamicResolution.scale() == doctest::Approx(0.5f));
+}
+
+TEST_CASE("Scale settles where the cost model meets the budget")
+{
+    Render::DynamicResolution dynamicResolution{16.0f, 0.25f, 1.0f};
+
+    // Cost proportional to the pixel count, 32 ms at full scale
+    for (int frame = 0; frame < 200; ++frame)
+    {
+        const float scale = dynamicResolution.scale();
+        dynamicResolution.update(32.0f * scale * scale);
+    }
+
+    const float settledScale = dynamicResolution.scale();
+    const float settledCost = 32.0f * settledScale * settledScale;
+    CHECK(settledCost <= 16.0f);
+    CHECK(settledCost >= 12.0f);
+}
+
+TEST_CASE("Cheap frames return to full scale")
+{
+    Render::DynamicResolution dynamicResolution{16.0f, 0.5f, 1.0f};
+    for (int frame = 0; frame < 20; ++frame)
+    {
+        dynamicResolution.update(40.0f);
+    }
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        dynamicResolution.update(2.0f);
+    }
+    CHECK(dynamicResolution.scale() == doctest::Approx(1.0f));
+}
+
+TEST_CASE("Scaled dimensions stay on whole tiles")
+{
+    CHECK(Render::DynamicResolution::scaleDimension(1920u, 1.0f) == 1920u);
+    CHECK(Render::DynamicResolution::scaleDimension(1080u, 0.5f) == 544u);
+    CHECK(Render::DynamicResolution::scaleDimension(1920u, 0.001f) == 8u);
+    CHECK(Render::DynamicResolution::scaleDimension(1083u, 1.0f) == 1083u);
+}
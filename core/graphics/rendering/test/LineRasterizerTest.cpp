@@ -0,0 +1,174 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <graphics/rendering/inc/ColorBuffer.h>
+#include <graphics/rendering/inc/DepthBuffer.h>
+#include <graphics/rendering/inc/LineRasterizer.h>
+
+#include "doctest/doctest.h"
+
+namespace
+{
+    constexpr uint32_t CLEAR_COLOR = 0x000000FFu;
+    constexpr uint32_t LINE_COLOR = 0xFFFFFFFFu;
+    constexpr size_t WIDTH = 37u;
+    constexpr size_t HEIGHT = 21u;
+
+    size_t countLinePixels(const Render::ColorBuffer& colorBuffer)
+    {
+        size_t count{0};
+        for (size_t y = 0; y < colorBuffer.height(); ++y)
+        {
+            for (size_t x = 0; x < colorBuffer.width(); ++x)
+            {
+                count += colorBuffer.at(x, y) == LINE_COLOR ? 1u : 0u;
+            }
+        }
+        return count;
+    }
+}
+
+TEST_CASE("Lines cover both end points and every step between them")
+{
+    Render::ColorBuffer colorBuffer{WIDTH, HEIGHT, CLEAR_COLOR};
+    colorBuffer.clear();
+
+    Render::drawWireLine(colorBuffer, {2.0f, 3.0f}, {10.0f, 7.0f}, LINE_COLOR);
+
+    CHECK(colorBuffer.at(2u, 3u) == LINE_COLOR);
+    CHECK(colorBuffer.at(10u, 7u) == LINE_COLOR);
+    CHECK(countLinePixels(colorBuffer) == 9u);
+}
+
+TEST_CASE("A line across the whole buffer keeps only its visible part")
+{
+    Render::ColorBuffer colorBuffer{WIDTH, HEIGHT, CLEAR_COLOR};
+    colorBuffer.clear();
+
+    Render::drawWireLine(colorBuffer, {-10000.0f, 5.0f}, {10000.0f, 5.0f}, LINE_COLOR);
+
+    CHECK(countLinePixels(colorBuffer) == WIDTH);
+    CHECK(colorBuffer.at(0u, 5u) == LINE_COLOR);
+    CHECK(colorBuffer.at(WIDTH - 1u, 5u) == LINE_COLOR);
+}
+
+TEST_CASE("Lines outside the buffer draw nothing, lines through a corner stay inside")
+{
+    Render::ColorBuffer colorBuffer{WIDTH, HEIGHT, CLEAR_COLOR};
+    colorBuffer.clear();
+
+    Render::drawWireLine(colorBuffer, {-50.0f, -5.0f}, {100.0f, -1.0f}, LINE_COLOR);
+    Render::drawWireLine(colorBuffer, {40.0f, 0.0f}, {60.0f, 20.0f}, LINE_COLOR);
+    CHECK(countLinePixels(colorBuffer) == 0u);
+
+    Render::drawWireLine(colorBuffer, {-5.0f, -5.0f}, {100.0f, 100.0f}, LINE_COLOR);
+    CHECK(colorBuffer.at(0u, 0u) == LINE_COLOR);
+    CHECK(colorBuffer.at(HEIGHT - 1u, HEIGHT - 1u) == LINE_COLOR);
+    CHECK(countLinePixels(colorBuffer) == HEIGHT);
+}
+
+TEST_CASE_TEMPLATE("Overlay lines are hidden behind nearer depth only", Format,
+                   Render::FloatDepth, Render::ReversedFloatDepth, Render::Unorm16Depth, Render::Unorm24Depth)
+{
+    Render::ColorBuffer colorBuffer{WIDTH, HEIGHT, CLEAR_COLOR};
+    Render::DepthBuffer<Format> depthBuffer{WIDTH, HEIGHT};
+    colorBuffer.clear();
+    depthBuffer.clear();
+
+    // A surface at distance 2 over the left half of row 4
+    for (size_t x = 0; x < WIDTH / 2u; ++x)
+    {
+        depthBuffer.write(x, 4u, depthBuffer.encode(1.0f / 2.0f));
+    }
+
+    // Behind the surface
+    Render::drawWireLine(colorBuffer, {0.0f, 4.0f, 1.0f / 8.0f}, {WIDTH - 1.0f, 4.0f, 1.0f / 8.0f}, LINE_COLOR, 0.0f, depthBuffer);
+    CHECK(colorBuffer.at(3u, 4u) == CLEAR_COLOR);
+    CHECK(colorBuffer.at(WIDTH - 1u, 4u) == LINE_COLOR);
+    CHECK(countLinePixels(colorBuffer) == WIDTH - WIDTH / 2u);
+
+    // On the surface, as the edge of its own triangle
+    Render::drawWireLine(colorBuffer, {0.0f, 4.0f, 1.0f / 2.0f}, {WIDTH - 1.0f, 4.0f, 1.0f / 2.0f}, LINE_COLOR, 0.0f, depthBuffer);
+    CHECK(countLinePixels(colorBuffer) == WIDTH);
+}
+
+TEST_CASE_TEMPLATE("Overlay lines stay hidden behind a thin slab and win over their own sloped fill", Format,
+                   Render::FloatDepth, Render::ReversedFloatDepth, Render::Unorm16Depth, Render::Unorm24Depth)
+{
+    Render::ColorBuffer colorBuffer{WIDTH, HEIGHT, CLEAR_COLOR};
+    Render::DepthBuffer<Format> depthBuffer{WIDTH, HEIGHT};
+    colorBuffer.clear();
+    depthBuffer.clear();
+
+    // A slab at distance 2 over row 4, the edge of a surface half a percent behind it
+    for (size_t x = 0; x < WIDTH; ++x)
+    {
+        depthBuffer.write(x, 4u, depthBuffer.encode(1.0f / 2.0f));
+    }
+    Render::drawWireLine(colorBuffer, {0.0f, 4.0f, 1.0f / 2.01f}, {WIDTH - 1.0f, 4.0f, 1.0f / 2.01f}, LINE_COLOR, 0.0f,
+                         depthBuffer);
+    CHECK(countLinePixels(colorBuffer) == 0u);
+
+    // A surface coming towards the camera along y, its edge half a pixel above the centers of row 8 where
+    // it was filled. The fill is nearer than the edge by half a pixel of the slope, which the offset covers.
+    constexpr float SLOPE = 0.01f;
+    constexpr float EDGE_RECIPROCAL_W = 0.25f;
+    for (size_t x = 0; x < WIDTH; ++x)
+    {
+        depthBuffer.write(x, 8u, depthBuffer.encode(EDGE_RECIPROCAL_W + 0.5f * SLOPE));
+    }
+    const Render::LineVertex edgeStart{0.0f, 8.0f, EDGE_RECIPROCAL_W};
+    const Render::LineVertex edgeEnd{WIDTH - 1.0f, 8.0f, EDGE_RECIPROCAL_W};
+    Render::drawWireLine(colorBuffer, edgeStart, edgeEnd, LINE_COLOR, 0.0f, depthBuffer);
+    CHECK(countLinePixels(colorBuffer) == 0u);
+    Render::drawWireLine(colorBuffer, edgeStart, edgeEnd, LINE_COLOR, SLOPE, depthBuffer);
+    CHECK(countLinePixels(colorBuffer) == WIDTH);
+}
+
+TEST_CASE("Anti-aliased lines on pixel centers cover their pixels fully, half at the end points")
+{
+    Render::ColorBuffer colorBuffer{WIDTH, HEIGHT, CLEAR_COLOR};
+    colorBuffer.clear();
+
+    Render::drawWireLineAntialiased(colorBuffer, {2.0f, 5.0f}, {12.0f, 5.0f}, LINE_COLOR);
+
+    CHECK(countLinePixels(colorBuffer) == 9u);
+    CHECK(colorBuffer.at(3u, 5u) == LINE_COLOR);
+    CHECK(colorBuffer.at(3u, 6u) == CLEAR_COLOR);
+    // Half of 255 in every channel, 255 * 128 / 256
+    CHECK(colorBuffer.at(2u, 5u) == 0x7F7F7FFFu);
+    CHECK(colorBuffer.at(12u, 5u) == 0x7F7F7FFFu);
+}
+
+TEST_CASE("Anti-aliased lines between pixel centers split the coverage")
+{
+    Render::ColorBuffer colorBuffer{WIDTH, HEIGHT, CLEAR_COLOR};
+    colorBuffer.clear();
+
+    // Steep, halfway between columns 6 and 7
+    Render::drawWireLineAntialiased(colorBuffer, {6.5f, 1.0f}, {6.5f, 15.0f}, LINE_COLOR);
+
+    CHECK(countLinePixels(colorBuffer) == 0u);
+    CHECK(colorBuffer.at(6u, 8u) == 0x7F7F7FFFu);
+    CHECK(colorBuffer.at(7u, 8u) == 0x7F7F7FFFu);
+    CHECK(colorBuffer.at(5u, 8u) == CLEAR_COLOR);
+    CHECK(colorBuffer.at(8u, 8u) == CLEAR_COLOR);
+}
+
+TEST_CASE("Anti-aliased lines are clipped like the aliased ones")
+{
+    Render::ColorBuffer colorBuffer{WIDTH, HEIGHT, CLEAR_COLOR};
+    colorBuffer.clear();
+
+    Render::drawWireLineAntialiased(colorBuffer, {-50.0f, -5.0f}, {100.0f, -1.0f}, LINE_COLOR);
+    for (size_t y = 0; y < HEIGHT; ++y)
+    {
+        for (size_t x = 0; x < WIDTH; ++x)
+        {
+            REQUIRE(colorBuffer.at(x, y) == CLEAR_COLOR);
+        }
+    }
+
+    // Along the bottom row, the second pixel of every pair is off the buffer
+    Render::drawWireLineAntialiased(colorBuffer, {-100.0f, HEIGHT - 1.0f}, {100.0f, HEIGHT - 1.0f}, LINE_COLOR);
+    CHECK(countLinePixels(colorBuffer) == WIDTH - 2u);
+}
@@ -0,0 +1,80 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+#include "common/inc/Vectors.hpp"
+#include "graphics/shapes/inc/Mesh.h"
+#include "graphics/textures/inc/Textures.h"
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "glm/mat4x4.hpp"
+
+// Placement of an object in the world: scale, then rotation about X, Y and Z in degrees, then translation
+struct Transform
+{
+    vect3_t<float> rotation{0.0f, 0.0f, 0.0f};
+    vect3_t<float> scale{1.0f, 1.0f, 1.0f};
+    vect3_t<float> translation{0.0f, 0.0f, 0.0f};
+};
+
+[[nodiscard]] glm::mat4x4 makeWorldMatrix(const Transform& transform);
+
+using MeshId = uint32_t;
+using TextureId = uint16_t;
+
+// Drawn with the error color in textured states, like any texel outside its texture
+constexpr TextureId NO_TEXTURE = std::numeric_limits<TextureId>::max();
+
+// One object of the scene: the mesh it draws and its texture. Its world matrix is in Scene::worldMatrices().
+struct MeshInstance
+{
+    MeshId mesh{0};
+    TextureId texture{NO_TEXTURE};
+    bool isOccluder{false};   // Large objects worth rasterizing into the occlusion buffer before anything else
+};
+
+// Consecutive instances drawing the same mesh with the same texture, the geometry stage takes them in one go
+struct InstanceBatch
+{
+    MeshId mesh{0};
+    TextureId texture{NO_TEXTURE};
+    uint32_t first{0};
+    uint32_t count{0};
+};
+
+// Everything the geometry stage draws in a frame. Meshes and textures are loaded once and referred to by id,
+// the instances place them in the world. An instance costs a world matrix, however large its mesh.
+// Ids are indices and stay valid for the lifetime of the scene.
+class Scene
+{
+public:
+    MeshId addMesh(Mesh mesh);
+    TextureId addTexture(Texture2dArray texture);
+    uint32_t addInstance(MeshId mesh, const Transform& transform, TextureId texture = NO_TEXTURE,
+                         bool isOccluder = false);
+    // One instance per transform, numbered consecutively from the returned id
+    uint32_t addInstances(MeshId mesh, std::span<const Transform> transforms, TextureId texture = NO_TEXTURE);
+
+    // Moves an instance, its world matrix follows
+    void setTransform(uint32_t instance, const Transform& transform);
+    void setOccluder(const uint32_t instance, const bool isOccluder) { _instances[instance].isOccluder = isOccluder; }
+
+    [[nodiscard]] const Mesh& mesh(const MeshId mesh) const { return _meshes[mesh]; }
+    [[nodiscard]] std::span<const Texture2dArray> textures() const { return _textures; }
+    [[nodiscard]] std::span<const MeshInstance> instances() const { return _instances; }
+    // Packed in instance order, so a pass over every instance streams through one array
+    [[nodiscard]] std::span<const glm::mat4x4> worldMatrices() const { return _worldMatrices; }
+    [[nodiscard]] std::span<const InstanceBatch> batches() const { return _batches; }
+
+private:
+    std::vector<Mesh> _meshes;
+    std::vector<Texture2dArray> _textures;
+    std::vector<MeshInstance> _instances;
+    std::vector<glm::mat4x4> _worldMatrices;
+    std::vector<InstanceBatch> _batches;
+};
+
+#endif //SCENE_H
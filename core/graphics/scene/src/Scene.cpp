@@ -0,0 +1,76 @@
+#include "graphics/scene/inc/Scene.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <utility>
+
+glm::mat4x4 makeWorldMatrix(const Transform& transform)
+{
+    const auto& [rotation, scale, translation] = transform;
+
+    // Scale
+    const glm::mat4 scaleMatrix = glm::scale(glm::mat4(1.0f), glm::vec3(scale.x, scale.y, scale.z));
+
+    // Rotation (X → Y → Z)
+    const glm::mat4 rotationMatrix =
+        glm::rotate(glm::mat4(1.0f), glm::radians(rotation.x), glm::vec3(1, 0, 0)) *
+        glm::rotate(glm::mat4(1.0f), glm::radians(rotation.y), glm::vec3(0, 1, 0)) *
+        glm::rotate(glm::mat4(1.0f), glm::radians(rotation.z), glm::vec3(0, 0, 1));
+
+    // Translation
+    const glm::mat4 translationMatrix = glm::translate(glm::mat4(1.0f),
+                                                       glm::vec3(translation.x, translation.y, translation.z));
+
+    // World matrix (T * R * S)
+    return translationMatrix * rotationMatrix * scaleMatrix;
+}
+
+MeshId Scene::addMesh(Mesh mesh)
+{
+    _meshes.push_back(std::move(mesh));
+    return static_cast<MeshId>(_meshes.size() - 1u);
+}
+
+TextureId Scene::addTexture(Texture2dArray texture)
+{
+    _textures.push_back(std::move(texture));
+    return static_cast<TextureId>(_textures.size() - 1u);
+}
+
+uint32_t Scene::addInstance(const MeshId mesh, const Transform& transform, const TextureId texture,
+                            const bool isOccluder)
+{
+    const auto instance = addInstances(mesh, std::span{&transform, 1u}, texture);
+    setOccluder(instance, isOccluder);
+    return instance;
+}
+
+uint32_t Scene::addInstances(const MeshId mesh, const std::span<const Transform> transforms, const TextureId texture)
+{
+    const auto first = static_cast<uint32_t>(_instances.size());
+    const auto count = static_cast<uint32_t>(transforms.size());
+
+    _instances.reserve(_instances.size() + count);
+    _worldMatrices.reserve(_worldMatrices.size() + count);
+    for (const auto& transform : transforms)
+    {
+        _worldMatrices.push_back(makeWorldMatrix(transform));
+        _instances.push_back({.mesh = mesh, .texture = texture});
+    }
+
+    // Instances that follow a batch of the same mesh and texture extend it
+    if (!_batches.empty() && _batches.back().mesh == mesh && _batches.back().texture == texture)
+    {
+        _batches.back().count += count;
+    }
+    else if (count > 0u)
+    {
+        _batches.push_back({.mesh = mesh, .texture = texture, .first = first, .count = count});
+    }
+    return first;
+}
+
+void Scene::setTransform(const uint32_t instance, const Transform& transform)
+{
+    _worldMatrices[instance] = makeWorldMatrix(transform);
+}
@@ -0,0 +1,101 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <graphics/pipeline/inc/GeometryStage.h>
+#include <graphics/scene/inc/Scene.h>
+#include <graphics/shapes/inc/Mesh.h>
+
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <span>
+#include <vector>
+
+namespace
+{
+    Mesh makeCube()
+    {
+        return makeMesh({cubeMeshVert.begin(), cubeMeshVert.end()}, {cubeMeshFaces.begin(), cubeMeshFaces.end()});
+    }
+
+    size_t countTextured(const std::vector<Triangle>& triangles, const TextureId texture)
+    {
+        return static_cast<size_t>(std::ranges::count_if(triangles, [texture](const Triangle& triangle)
+        {
+            return triangle._texture == texture;
+        }));
+    }
+}
+
+TEST_CASE("Instance world matrices follow the transform")
+{
+    Scene scene;
+    const MeshId cube = scene.addMesh(makeCube());
+    const uint32_t instance = scene.addInstance(cube, {.scale = {2.0f, 1.0f, 1.0f}, .translation = {0.0f, 0.0f, 5.0f}});
+
+    const glm::mat4x4& world = scene.worldMatrices()[instance];
+    CHECK(world[0][0] == doctest::Approx(2.0f));
+    CHECK(world[3][2] == doctest::Approx(5.0f));
+
+    // A quarter turn about Y takes the scaled x axis onto -z
+    scene.setTransform(instance, {.rotation = {0.0f, 90.0f, 0.0f}, .scale = {2.0f, 1.0f, 1.0f}});
+    const glm::mat4x4& turned = scene.worldMatrices()[instance];
+    CHECK(turned[0][0] == doctest::Approx(0.0f));
+    CHECK(turned[0][2] == doctest::Approx(-2.0f));
+    CHECK(turned[3][2] == doctest::Approx(0.0f));
+}
+
+TEST_CASE("Every instance of the scene goes through one geometry pass with its own texture")
+{
+    Scene scene;
+    const MeshId cube = scene.addMesh(makeCube());
+    const TextureId first = scene.addTexture({});
+    const TextureId second = scene.addTexture({});
+
+    scene.addInstance(cube, {.translation = {-2.5f, 0.0f, 6.0f}}, first);
+    scene.addInstance(cube, {.translation = {2.5f, 0.0f, 6.0f}}, second);
+    // Behind the camera, nothing of it is left after culling
+    scene.addInstance(cube, {.translation = {0.0f, 0.0f, -6.0f}}, first);
+
+    Render::GeometryStage geometryStage{{1.0471976f, 0.1f, 100.0f}, std::chrono::milliseconds{16}, nullptr};
+    geometryStage.setScene(&scene);
+    geometryStage.setCamera(Camera{});
+
+    Render::FrameGeometry geometry;
+    geometryStage.process({.targetWidth = 640u, .targetHeight = 360u, .aspectRatio = 640.0f / 360.0f}, geometry);
+
+    CHECK(geometry.triangles.size() == 2u * N_CUBE_MESH_FACES);
+    CHECK(countTextured(geometry.triangles, first) == N_CUBE_MESH_FACES);
+    CHECK(countTextured(geometry.triangles, second) == N_CUBE_MESH_FACES);
+    CHECK(geometry.sorter.drawOrder().size() == geometry.triangles.size());
+}
+
+TEST_CASE("Instances of one mesh share a batch and a packed array of world matrices")
+{
+    Scene scene;
+    const MeshId cube = scene.addMesh(makeCube());
+    const TextureId texture = scene.addTexture({});
+
+    std::vector<Transform> transforms(64u);
+    for (size_t i = 0; i < transforms.size(); ++i)
+    {
+        transforms[i].translation = {static_cast<float>(i % 8u) * 3.0f, static_cast<float>(i / 8u) * 3.0f, 20.0f};
+    }
+    CHECK(scene.addInstances(cube, transforms, texture) == 0u);
+    // Same mesh and texture, the batch grows
+    scene.addInstance(cube, {.translation = {0.0f, -3.0f, 20.0f}}, texture);
+    // Another texture starts a new one
+    CHECK(scene.addInstances(cube, std::span{transforms}.first(4u), NO_TEXTURE) == 65u);
+
+    REQUIRE(scene.batches().size() == 2u);
+    CHECK(scene.batches()[0].first == 0u);
+    CHECK(scene.batches()[0].count == 65u);
+    CHECK(scene.batches()[1].first == 65u);
+    CHECK(scene.batches()[1].count == 4u);
+    CHECK(scene.batches()[1].texture == NO_TEXTURE);
+
+    CHECK(scene.worldMatrices().size() == scene.instances().size());
+    CHECK(scene.worldMatrices()[9][3][0] == doctest::Approx(3.0f));
+    CHECK(scene.worldMatrices()[9][3][1] == doctest::Approx(3.0f));
+    CHECK(scene.worldMatrices()[64][3][1] == doctest::Approx(-3.0f));
+}
@@ -2,6 +2,7 @@
 #define MESH_H
 
 #include "graphics/shapes/inc/Triangle.h"
+#include "graphics/shapes/inc/VertexStream.h"
 
 #include "common/inc/Vectors.hpp"
 
@@ -57,15 +58,48 @@ constexpr std::array<Face, N_CUBE_MESH_FACES> cubeMeshFaces = {{
   { .a = 6, .b = 1, .c = 4, .color = CUBE_MESH_COLOR,
     .a_uv = {0,1}, .b_uv = {1,0}, .c_uv = {1,1}}
 }};
+struct BoundingBox
+{
+    vect3_t<float> min{};
+    vect3_t<float> max{};
+
+    [[nodiscard]] std::array<vect3_t<float>, 8> corners() const;
+};
+
+// Sphere around every vertex, the cheaper first test before the box
+struct BoundingSphere
+{
+    vect3_t<float> center{};
+    float radius{0.0f};
+};
+
+// Every undirected edge of a mesh gets a number, shared by all faces that have it, so each edge can be
+// drawn once in wireframe. Per face the edges a-b, b-c and c-a, in that order.
+struct FaceEdges
+{
+    std::vector<std::array<uint32_t, 3>> faceEdges;
+    size_t edgeCount{0};
+};
+
+// Geometry in model space; where it is drawn and how often is up to the scene instances using it
 struct Mesh
 {
     std::vector<vect3_t<float>> vertices;
     std::vector<Face> faces;
-    vect3_t<float> rotation{0.0,0.0,0.0};
-    vect3_t<float> scale{1.0f,1.0f,1.0f};
-    vect3_t<float> translation{0.0f,0.0f,0.0f};
+    BoundingBox bounds{};    // Model space, refresh with computeBoundingBox after editing vertices
+    BoundingSphere sphere{}; // Model space, refresh with computeBoundingSphere after the bounds
+    VertexStream positions;  // SoA copy of vertices for the batch transform, refresh with makeVertexStream
+    FaceEdges edges;         // Shared edge numbers, refresh with computeFaceEdges; without them every edge is drawn
 };
 
+[[nodiscard]] BoundingBox computeBoundingBox(const std::vector<vect3_t<float>>& vertices);
+// Centered on the box, so it is never looser than the box's own circumscribed sphere
+[[nodiscard]] BoundingSphere computeBoundingSphere(const std::vector<vect3_t<float>>& vertices, const BoundingBox& bounds);
+[[nodiscard]] FaceEdges computeFaceEdges(const std::vector<Face>& faces);
+
+// Mesh with its bounding volumes, vertex stream and edges computed from the vertices and faces
+[[nodiscard]] Mesh makeMesh(std::vector<vect3_t<float>> vertices, std::vector<Face> faces);
+
 void LoadOBJFile(const std::filesystem::path& pathToOBJ,
                  std::vector<vect3_t<float>>& vertexArray,
                  std::vector<Face>& facesArray);
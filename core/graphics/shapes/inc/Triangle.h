@@ -8,9 +8,6 @@
 
 #include <array>
 
-#include "utils/inc/GlmAdapter.h"
-#include "utils/inc/GlmAdapter.h"
-
 struct Face
 {
     int a{};
@@ -27,6 +24,10 @@ struct Triangle
     std::array<glm::vec4, 3> _points;
     uint32_t _color{0xFFFFFFFF};
     std::array<Texture2d,3> textCoord{};
+    // Bit i: draw the edge from point i to point (i + 1) % 3 in wireframe, cleared when another triangle draws it
+    uint8_t _edgeMask{0b111};
+    // Index of the texture in the scene it came from, see Scene::textures()
+    uint16_t _texture{0};
 
     [[nodiscard]] Triangle sortByHeight() const;
 
@@ -0,0 +1,47 @@
+#ifndef VERTEXSTREAM_H
+#define VERTEXSTREAM_H
+
+#include "common/inc/Vect4f.hpp"
+#include "common/inc/Vectors.hpp"
+
+#include <cstddef>
+#include <vector>
+
+// Vertices per iteration of the batch kernels, streams are padded to a multiple of it
+constexpr size_t VERTEX_BATCH_SIZE = 8u;
+
+[[nodiscard]] constexpr size_t paddedVertexCount(const size_t count)
+{
+    return (count + VERTEX_BATCH_SIZE - 1u) / VERTEX_BATCH_SIZE * VERTEX_BATCH_SIZE;
+}
+
+// Positions as structure of arrays: one contiguous array per coordinate, so a kernel reads 8 x, 8 y and 8 z
+// with three vector loads instead of picking them out of 12-byte structs. The padding past count is zero.
+struct VertexStream
+{
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    size_t count{0};
+};
+
+// Result of a transform; w is kept because a projection makes it differ per vertex
+struct TransformedVertexStream
+{
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> w;
+    size_t count{0};
+
+    [[nodiscard]] vect4f_t operator[](const size_t index) const { return {x[index], y[index], z[index], w[index]}; }
+};
+
+[[nodiscard]] VertexStream makeVertexStream(const std::vector<vect3_t<float>>& vertices);
+
+// Transforms every point of the stream (w = 1) by the matrix, a batch of 8 per iteration with AVX, SSE or
+// plain C++. Each lane computes exactly what mat4f_t::transform does. The output is resized to fit and
+// keeps its capacity, so transforming into the same stream every frame does not allocate.
+void transformVertexStream(const mat4f_t& matrix, const VertexStream& input, TransformedVertexStream& output);
+
+#endif //VERTEXSTREAM_H
@@ -1,11 +1,16 @@
+#include "graphics/shapes/inc/Mesh.h"
 #include "graphics/shapes/inc/Triangle.h"
 
+#include <algorithm>
+#include <cmath>
 #include <filesystem>
 #include <format>
 #include <fstream>
 #include <iostream>
 #include <ranges>
 #include <regex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 
@@ -159,4 +164,80 @@ void LoadOBJFileSimplified(const std::filesystem::path& pathToOBJ, std::vector<v
 
 }
 
+std::array<vect3_t<float>, 8> BoundingBox::corners() const
+{
+    return {{
+        {min.x, min.y, min.z}, {max.x, min.y, min.z}, {min.x, max.y, min.z}, {max.x, max.y, min.z},
+        {min.x, min.y, max.z}, {max.x, min.y, max.z}, {min.x, max.y, max.z}, {max.x, max.y, max.z}
+    }};
+}
+
+BoundingBox computeBoundingBox(const std::vector<vect3_t<float>>& vertices)
+{
+    if (vertices.empty())
+    {
+        return {};
+    }
+
+    BoundingBox bounds{vertices.front(), vertices.front()};
+    for (const auto& vertex : vertices)
+    {
+        bounds.min = {std::min(bounds.min.x, vertex.x), std::min(bounds.min.y, vertex.y), std::min(bounds.min.z, vertex.z)};
+        bounds.max = {std::max(bounds.max.x, vertex.x), std::max(bounds.max.y, vertex.y), std::max(bounds.max.z, vertex.z)};
+    }
+
+    return bounds;
+}
+
+BoundingSphere computeBoundingSphere(const std::vector<vect3_t<float>>& vertices, const BoundingBox& bounds)
+{
+    BoundingSphere sphere{.center = (bounds.min + bounds.max) * 0.5f};
+
+    float radiusSquared{0.0f};
+    for (const auto& vertex : vertices)
+    {
+        const auto offset = vertex - sphere.center;
+        radiusSquared = std::max(radiusSquared, offset.x * offset.x + offset.y * offset.y + offset.z * offset.z);
+    }
+    sphere.radius = std::sqrt(radiusSquared);
+
+    return sphere;
+}
+
+FaceEdges computeFaceEdges(const std::vector<Face>& faces)
+{
+    FaceEdges edges;
+    edges.faceEdges.reserve(faces.size());
+
+    // Keyed by both vertex indices, smaller first, so the two windings of a shared edge meet
+    std::unordered_map<uint64_t, uint32_t> edgeNumbers;
+    edgeNumbers.reserve(faces.size() * 3u / 2u);
+    const auto edgeNumber = [&edgeNumbers](const int from, const int to)
+    {
+        const auto low = static_cast<uint32_t>(std::min(from, to));
+        const auto high = static_cast<uint32_t>(std::max(from, to));
+        const auto [it, isNew] = edgeNumbers.try_emplace((static_cast<uint64_t>(low) << 32u) | high,
+                                                         static_cast<uint32_t>(edgeNumbers.size()));
+        return it->second;
+    };
+
+    for (const auto& face : faces)
+    {
+        edges.faceEdges.push_back({edgeNumber(face.a, face.b), edgeNumber(face.b, face.c), edgeNumber(face.c, face.a)});
+    }
+    edges.edgeCount = edgeNumbers.size();
 
+    return edges;
+}
+
+Mesh makeMesh(std::vector<vect3_t<float>> vertices, std::vector<Face> faces)
+{
+    Mesh mesh;
+    mesh.vertices = std::move(vertices);
+    mesh.faces = std::move(faces);
+    mesh.bounds = computeBoundingBox(mesh.vertices);
+    mesh.sphere = computeBoundingSphere(mesh.vertices, mesh.bounds);
+    mesh.positions = makeVertexStream(mesh.vertices);
+    mesh.edges = computeFaceEdges(mesh.faces);
+    return mesh;
+}
@@ -0,0 +1,121 @@
+#include "graphics/shapes/inc/VertexStream.h"
+
+#include <array>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    // Column-major elements, m[column * 4 + row]
+    using Matrix = std::array<float, 16>;
+
+    void resizeOutput(TransformedVertexStream& output, const size_t count)
+    {
+        const size_t padded = paddedVertexCount(count);
+        output.x.resize(padded);
+        output.y.resize(padded);
+        output.z.resize(padded);
+        output.w.resize(padded);
+        output.count = count;
+    }
+
+#if defined(__AVX__)
+    // One row of the matrix applied to 8 points, in the (a + b) + (c + d) order of mat4f_t::transform
+    __m256 transformRow(const Matrix& m, const size_t row, const __m256 x, const __m256 y, const __m256 z)
+    {
+        const __m256 xy = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(m[row]), x),
+                                        _mm256_mul_ps(_mm256_set1_ps(m[4 + row]), y));
+        const __m256 zw = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(m[8 + row]), z), _mm256_set1_ps(m[12 + row]));
+        return _mm256_add_ps(xy, zw);
+    }
+
+    void transformBatch(const Matrix& m, const VertexStream& input, TransformedVertexStream& output, const size_t i)
+    {
+        const __m256 x = _mm256_loadu_ps(input.x.data() + i);
+        const __m256 y = _mm256_loadu_ps(input.y.data() + i);
+        const __m256 z = _mm256_loadu_ps(input.z.data() + i);
+
+        _mm256_storeu_ps(output.x.data() + i, transformRow(m, 0u, x, y, z));
+        _mm256_storeu_ps(output.y.data() + i, transformRow(m, 1u, x, y, z));
+        _mm256_storeu_ps(output.z.data() + i, transformRow(m, 2u, x, y, z));
+        _mm256_storeu_ps(output.w.data() + i, transformRow(m, 3u, x, y, z));
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    __m128 transformRow(const Matrix& m, const size_t row, const __m128 x, const __m128 y, const __m128 z)
+    {
+        const __m128 xy = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[row]), x), _mm_mul_ps(_mm_set1_ps(m[4 + row]), y));
+        const __m128 zw = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[8 + row]), z), _mm_set1_ps(m[12 + row]));
+        return _mm_add_ps(xy, zw);
+    }
+
+    // Two 4-wide halves per batch keep the loop structure of the AVX kernel
+    void transformBatch(const Matrix& m, const VertexStream& input, TransformedVertexStream& output, const size_t i)
+    {
+        for (size_t half = i; half < i + VERTEX_BATCH_SIZE; half += 4u)
+        {
+            const __m128 x = _mm_loadu_ps(input.x.data() + half);
+            const __m128 y = _mm_loadu_ps(input.y.data() + half);
+            const __m128 z = _mm_loadu_ps(input.z.data() + half);
+
+            _mm_storeu_ps(output.x.data() + half, transformRow(m, 0u, x, y, z));
+            _mm_storeu_ps(output.y.data() + half, transformRow(m, 1u, x, y, z));
+            _mm_storeu_ps(output.z.data() + half, transformRow(m, 2u, x, y, z));
+            _mm_storeu_ps(output.w.data() + half, transformRow(m, 3u, x, y, z));
+        }
+    }
+#else
+    // Independent lanes over fixed-size arrays, which compilers turn into NEON or whatever vector unit there is
+    void transformBatch(const Matrix& m, const VertexStream& input, TransformedVertexStream& output, const size_t i)
+    {
+        const std::array<std::vector<float>*, 4> rows{&output.x, &output.y, &output.z, &output.w};
+        for (size_t row = 0; row < rows.size(); ++row)
+        {
+            float* destination = rows[row]->data() + i;
+            for (size_t lane = 0; lane < VERTEX_BATCH_SIZE; ++lane)
+            {
+                destination[lane] = (m[row] * input.x[i + lane] + m[4 + row] * input.y[i + lane])
+                                  + (m[8 + row] * input.z[i + lane] + m[12 + row]);
+            }
+        }
+    }
+#endif
+}
+
+VertexStream makeVertexStream(const std::vector<vect3_t<float>>& vertices)
+{
+    const size_t padded = paddedVertexCount(vertices.size());
+
+    VertexStream stream;
+    stream.x.resize(padded, 0.0f);
+    stream.y.resize(padded, 0.0f);
+    stream.z.resize(padded, 0.0f);
+    stream.count = vertices.size();
+
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        stream.x[i] = vertices[i].x;
+        stream.y[i] = vertices[i].y;
+        stream.z[i] = vertices[i].z;
+    }
+    return stream;
+}
+
+void transformVertexStream(const mat4f_t& matrix, const VertexStream& input, TransformedVertexStream& output)
+{
+    Matrix m{};
+    for (size_t column = 0; column < 4u; ++column)
+    {
+        matrix.columns[column].store(m.data() + column * 4u);
+    }
+
+    resizeOutput(output, input.count);
+    const size_t padded = paddedVertexCount(input.count);
+    for (size_t i = 0; i < padded; i += VERTEX_BATCH_SIZE)
+    {
+        transformBatch(m, input, output, i);
+    }
+}
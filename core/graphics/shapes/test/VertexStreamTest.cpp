@@ -0,0 +1,57 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <graphics/shapes/inc/VertexStream.h>
+
+#include "doctest/doctest.h"
+
+#include <array>
+#include <random>
+#include <vector>
+
+TEST_CASE("Streams are padded to whole batches with zeros")
+{
+    const std::vector<vect3_t<float>> vertices{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}};
+    const VertexStream stream = makeVertexStream(vertices);
+
+    CHECK(stream.count == 3u);
+    REQUIRE(stream.x.size() == VERTEX_BATCH_SIZE);
+    CHECK(stream.x[1] == 4.0f);
+    CHECK(stream.y[2] == 8.0f);
+    CHECK(stream.z[0] == 3.0f);
+    CHECK(stream.x[3] == 0.0f);
+    CHECK(stream.z[VERTEX_BATCH_SIZE - 1u] == 0.0f);
+}
+
+TEST_CASE("The batch transform matches mat4f_t::transform exactly")
+{
+    std::mt19937 generator{7u};
+    std::uniform_real_distribution<float> distribution{-50.0f, 50.0f};
+
+    // A count that ends mid-batch, so the padded tail goes through the kernel too
+    std::vector<vect3_t<float>> vertices(37u);
+    for (auto& vertex : vertices)
+    {
+        vertex = {distribution(generator), distribution(generator), distribution(generator)};
+    }
+
+    std::array<float, 16> columnMajor{};
+    for (auto& element : columnMajor)
+    {
+        element = distribution(generator);
+    }
+    const mat4f_t matrix = mat4f_t::load(columnMajor.data());
+
+    TransformedVertexStream transformed;
+    transformVertexStream(matrix, makeVertexStream(vertices), transformed);
+    REQUIRE(transformed.count == vertices.size());
+
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        const vect4f_t expected = matrix.transform({vertices[i], 1.0f});
+        const vect4f_t actual = transformed[i];
+        CHECK(actual.x() == expected.x());
+        CHECK(actual.y() == expected.y());
+        CHECK(actual.z() == expected.z());
+        CHECK(actual.w() == expected.w());
+    }
+}
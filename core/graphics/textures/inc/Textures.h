@@ -3,6 +3,7 @@
 
 #include <array>
 #include <cstdint>
+#include <string>
 #include <vector>
 
 struct Texture2d
@@ -19,6 +20,9 @@ struct Texture2dArray
     std::vector<uint32_t> data;
 };
 
+// Decodes a PNG file into 0xRRGGBBAA texels, throws std::runtime_error when it can't be read
+std::vector<uint32_t> LoadPngToSDLExpectedFormat(const std::string& filePath, int& width, int& height);
+
 constexpr int TEXTURE_WIDTH{256};
 constexpr int TEXTURE_HEIGHT{256};
 constexpr int TEXTURE_CHANNELS{4};
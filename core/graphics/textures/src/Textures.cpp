@@ -0,0 +1,41 @@
+#include "graphics/textures/inc/Textures.h"
+
+#include "common/inc/Lodepng.h"
+
+#include <stdexcept>
+
+std::vector<uint32_t> LoadPngToSDLExpectedFormat(const std::string& filePath, int& width, int& height)
+{
+    std::vector<unsigned char> image;
+    unsigned w, h;
+
+    unsigned error = lodepng::decode(image, w, h, filePath, LodePNGColorType::LCT_RGBA);
+    if (error)
+    {
+        throw std::runtime_error("LodePNG load error " + std::to_string(error) + ": " + lodepng_error_text(error));
+    }
+
+    width = static_cast<int>(w);
+    height = static_cast<int>(h);
+    const size_t pixelCount = static_cast<size_t>(width) * height;
+    std::vector<uint32_t> result;
+    result.reserve(pixelCount);
+
+    for (size_t i = 0; i < pixelCount; ++i)
+    {
+        constexpr size_t C_CH_OFFSET{3u};
+        constexpr size_t B_CH_OFFSET{2u};
+        constexpr size_t G_CH_OFFSET{1u};
+        constexpr size_t R_CH_OFFSET{0u};
+        constexpr int numberOfChannels = 4;
+
+        const uint8_t r = image[i * numberOfChannels + R_CH_OFFSET];
+        const uint8_t g = image[i * numberOfChannels + G_CH_OFFSET];
+        const uint8_t b = image[i * numberOfChannels + B_CH_OFFSET];
+        const uint8_t a = image[i * numberOfChannels + C_CH_OFFSET];
+
+        result.push_back((r << 24) | (g << 16) | (b << 8) | a);
+    }
+
+    return result;
+}
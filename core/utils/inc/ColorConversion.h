@@ -0,0 +1,35 @@
+#ifndef COLORCONVERSION_H
+#define COLORCONVERSION_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Utils
+{
+
+// Planar YUV 4:2:0 destination. Y is width x height, U and V are ceil(width / 2) x ceil(height / 2),
+// every plane tightly packed.
+struct Yuv420Planes
+{
+    uint8_t* y{nullptr};
+    uint8_t* u{nullptr};
+    uint8_t* v{nullptr};
+};
+
+[[nodiscard]] constexpr size_t yuv420ChromaWidth(const size_t width) { return (width + 1u) / 2u; }
+[[nodiscard]] constexpr size_t yuv420ChromaHeight(const size_t height) { return (height + 1u) / 2u; }
+[[nodiscard]] constexpr size_t yuv420FrameSize(const size_t width, const size_t height)
+{
+    return width * height + 2u * yuv420ChromaWidth(width) * yuv420ChromaHeight(height);
+}
+
+// 0xRRGGBBAA pixels with rows pitch bytes apart to BT.601 limited range YUV 4:2:0. Chroma is the average of
+// each 2x2 block (centered siting); odd edges average what is there. Uses SSE2 when available.
+void rgbaToYuv420(const uint32_t* pixels, size_t width, size_t height, size_t pitch, const Yuv420Planes& planes);
+
+// Plain C++ version, bit-exact with the SIMD one: it handles the edges and is the reference in tests
+void rgbaToYuv420Scalar(const uint32_t* pixels, size_t width, size_t height, size_t pitch, const Yuv420Planes& planes);
+
+}
+
+#endif //COLORCONVERSION_H
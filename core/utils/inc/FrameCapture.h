@@ -0,0 +1,68 @@
+#ifndef FRAMECAPTURE_H
+#define FRAMECAPTURE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Utils
+{
+
+// Writes finished frames as a numbered PNG sequence without holding up the render loop. capture() only copies
+// the frame into one of a fixed set of buffers; encoder threads compress and save them in the background.
+// When every buffer is still waiting to be encoded the frame is dropped instead of waited for, and its
+// number is skipped so gaps in the sequence show where that happened.
+class FrameCapture
+{
+public:
+    explicit FrameCapture(std::filesystem::path directory, size_t queueCapacity = 4u, size_t encoderCount = 2u);
+
+    // Encodes the frames still queued before returning
+    ~FrameCapture();
+
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    // Queues a copy of a 0xRRGGBBAA frame whose rows are pitch bytes apart. False if it had to be dropped
+    bool capture(const uint32_t* pixels, size_t width, size_t height, size_t pitch);
+
+    [[nodiscard]] const std::filesystem::path& directory() const { return _directory; }
+    [[nodiscard]] size_t writtenFrames() const { return _writtenFrames.load(std::memory_order_relaxed); }
+    [[nodiscard]] size_t droppedFrames() const { return _droppedFrames.load(std::memory_order_relaxed); }
+
+private:
+    struct Frame
+    {
+        std::vector<uint32_t> pixels;
+        size_t width{0};
+        size_t height{0};
+        uint64_t number{0};
+    };
+
+    void encoderLoop();
+    void encode(Frame& frame);
+
+    std::filesystem::path _directory;
+    std::vector<Frame> _frames;
+    std::vector<Frame*> _freeFrames;
+    std::deque<Frame*> _queuedFrames;
+
+    std::mutex _mutex;
+    std::condition_variable _queuedCv;
+    std::vector<std::thread> _encoders;
+    bool _stopping{false};
+
+    uint64_t _nextFrameNumber{0};
+    std::atomic<size_t> _writtenFrames{0};
+    std::atomic<size_t> _droppedFrames{0};
+};
+
+}
+
+#endif //FRAMECAPTURE_H
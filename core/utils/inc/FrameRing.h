@@ -0,0 +1,121 @@
+#ifndef FRAMERING_H
+#define FRAMERING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Utils
+{
+
+// Fixed ring of frame slots passed between one submitting thread and one worker thread without locks.
+// Every slot cycles FREE -> SUBMITTED -> PROCESSED -> FREE; each side only ever waits on the state of the
+// slot it needs next (std::atomic wait/notify), so the worker can fill slot N + 1 while the submitter is
+// still consuming slot N. The submitter owns both the submit and the consume ends.
+template <typename T, size_t SLOT_COUNT = 2u>
+class FrameRing
+{
+    static_assert(SLOT_COUNT >= 2u, "A single slot cannot overlap the two stages");
+
+public:
+    // Submitter: the next slot to fill, waits until its previous frame was consumed
+    T& beginSubmit()
+    {
+        waitFor(_submitIndex, State::FREE);
+        return _slots[_submitIndex].value;
+    }
+
+    void submit()
+    {
+        publish(_submitIndex, State::SUBMITTED);
+        _submitIndex = (_submitIndex + 1u) % SLOT_COUNT;
+    }
+
+    // Worker: the oldest submitted slot, or nullptr once stop() was called
+    T* beginProcess()
+    {
+        if (!waitFor(_processIndex, State::SUBMITTED))
+        {
+            return nullptr;
+        }
+        return &_slots[_processIndex].value;
+    }
+
+    void finishProcess()
+    {
+        publish(_processIndex, State::PROCESSED);
+        _processIndex = (_processIndex + 1u) % SLOT_COUNT;
+    }
+
+    // Submitter: the oldest processed slot, waits for the worker to finish it
+    T& beginConsume()
+    {
+        waitFor(_consumeIndex, State::PROCESSED);
+        return _slots[_consumeIndex].value;
+    }
+
+    void finishConsume()
+    {
+        publish(_consumeIndex, State::FREE);
+        _consumeIndex = (_consumeIndex + 1u) % SLOT_COUNT;
+    }
+
+    // Wakes the worker out of beginProcess for good. Called by the submitter once it stopped submitting;
+    // the state itself changes so a worker about to block cannot miss the wake-up
+    void stop()
+    {
+        for (size_t index = 0; index < SLOT_COUNT; ++index)
+        {
+            publish(index, State::STOPPED);
+        }
+    }
+
+private:
+    enum class State : uint8_t
+    {
+        FREE,
+        SUBMITTED,
+        PROCESSED,
+        STOPPED
+    };
+
+    // Own cache line per slot so the two threads polling neighbouring states do not share one
+    struct alignas(64) Slot
+    {
+        std::atomic<State> state{State::FREE};
+        T value{};
+    };
+
+    // Acquire pairs with the release in publish, so the slot's value is visible once the state is seen
+    bool waitFor(const size_t index, const State expected)
+    {
+        auto& state = _slots[index].state;
+        for (State current = state.load(std::memory_order_acquire); current != expected;
+             current = state.load(std::memory_order_acquire))
+        {
+            if (current == State::STOPPED)
+            {
+                return false;
+            }
+            state.wait(current, std::memory_order_acquire);
+        }
+        return true;
+    }
+
+    void publish(const size_t index, const State state)
+    {
+        _slots[index].state.store(state, std::memory_order_release);
+        _slots[index].state.notify_all();
+    }
+
+    std::array<Slot, SLOT_COUNT> _slots{};
+
+    size_t _submitIndex{0};
+    size_t _consumeIndex{0};
+    size_t _processIndex{0};  // Only touched by the worker
+};
+
+}
+
+#endif //FRAMERING_H
@@ -0,0 +1,76 @@
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+#include <chrono>
+#include <cstddef>
+
+namespace Utils
+{
+
+struct FrameTimeStats
+{
+    size_t frameCount{0};
+    double meanMs{0.0};
+    double jitterMs{0.0};   // Standard deviation of the frame time
+    double minMs{0.0};
+    double maxMs{0.0};
+};
+
+// Paces frames against absolute deadlines on the monotonic clock. The wait sleeps while the deadline is
+// far away and spins through the last stretch, so a frame starts within microseconds of its deadline
+// instead of at the OS sleep granularity. Late frames keep the cadence unless they miss a whole period.
+class FrameScheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit FrameScheduler(Clock::duration framePeriod,
+                            Clock::duration spinThreshold = std::chrono::microseconds{2000});
+
+    // Blocks until the next frame is due and returns the time since the previous frame started
+    Clock::duration waitForNextFrame();
+
+    // Frame times recorded since the previous call
+    FrameTimeStats takeStats();
+
+private:
+    void waitUntil(Clock::time_point deadline) const;
+
+    Clock::duration _framePeriod;
+    Clock::duration _spinThreshold;
+    Clock::time_point _frameStart{};
+    Clock::time_point _nextDeadline{};
+    bool _isStarted{false};
+
+    size_t _frameCount{0};
+    double _sumMs{0.0};
+    double _sumSquaresMs{0.0};
+    double _minMs{0.0};
+    double _maxMs{0.0};
+};
+
+// Fixed-step simulation clock: real frame time is accumulated and consumed in equal steps, the remainder
+// is the interpolation factor between the last two simulated states.
+class FixedTimestep
+{
+public:
+    explicit FixedTimestep(std::chrono::nanoseconds step, size_t maxStepsPerFrame = 5u);
+
+    // Adds the frame time and returns how many steps to simulate. Time beyond maxStepsPerFrame is dropped
+    // so one long hitch cannot snowball into ever longer frames.
+    size_t advance(std::chrono::nanoseconds frameTime);
+
+    [[nodiscard]] float stepSeconds() const { return std::chrono::duration<float>(_step).count(); }
+
+    // Fraction of a step left in the accumulator, 0 = last state, 1 = the next one
+    [[nodiscard]] float alpha() const;
+
+private:
+    std::chrono::nanoseconds _step;
+    size_t _maxStepsPerFrame;
+    std::chrono::nanoseconds _accumulator{0};
+};
+
+}
+
+#endif //FRAMESCHEDULER_H
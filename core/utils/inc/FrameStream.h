@@ -0,0 +1,75 @@
+#ifndef FRAMESTREAM_H
+#define FRAMESTREAM_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Utils
+{
+
+enum class StreamFormat : uint8_t
+{
+    RGBA,  // Headerless R, G, B, A bytes per pixel, e.g. ffmpeg -f rawvideo -pix_fmt rgba
+    Y4M    // YUV4MPEG2 with 4:2:0 frames, self-describing for ffmpeg, x264 and friends
+};
+
+// Streams fixed-size frames to a file, a named pipe or stdout ("-", switched to binary mode) for an external video encoder.
+// write() converts the frame into one of a few reusable buffers and returns; a writer thread pushes them out
+// in order. A video stream cannot skip frames, so when the reader falls behind and every buffer is in use
+// write() waits for one instead of dropping.
+class FrameStream
+{
+public:
+    FrameStream(const std::string& path, StreamFormat format, size_t width, size_t height, unsigned frameRate,
+                size_t bufferCount = 3u);
+
+    // Writes what is still buffered and closes the output
+    ~FrameStream();
+
+    FrameStream(const FrameStream&) = delete;
+    FrameStream& operator=(const FrameStream&) = delete;
+
+    // False once the output could not be opened or a write failed, e.g. the reading end of the pipe closed
+    [[nodiscard]] bool isGood() const;
+
+    // Queues a 0xRRGGBBAA frame whose rows are pitch bytes apart. Frames of another size than the stream's are
+    // skipped, the stream format has no way to change size midway
+    bool write(const uint32_t* pixels, size_t width, size_t height, size_t pitch);
+
+    [[nodiscard]] size_t width() const { return _width; }
+    [[nodiscard]] size_t height() const { return _height; }
+
+private:
+    void writerLoop();
+    void convert(const uint32_t* pixels, size_t pitch, std::vector<uint8_t>& buffer) const;
+
+    StreamFormat _format;
+    size_t _width;
+    size_t _height;
+    size_t _frameBytes;
+
+    std::FILE* _output{nullptr};
+    bool _ownsOutput{false};
+
+    std::vector<std::vector<uint8_t>> _buffers;
+    std::vector<std::vector<uint8_t>*> _freeBuffers;
+    std::deque<std::vector<uint8_t>*> _queuedBuffers;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _queuedCv;
+    std::condition_variable _freeCv;
+    std::thread _writer;
+    bool _stopping{false};
+    bool _isGood{true};
+};
+
+}
+
+#endif //FRAMESTREAM_H
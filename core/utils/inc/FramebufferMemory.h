@@ -0,0 +1,35 @@
+#ifndef FRAMEBUFFERMEMORY_H
+#define FRAMEBUFFERMEMORY_H
+
+#include <cstddef>
+#include <memory>
+
+namespace Utils
+{
+
+constexpr size_t CACHE_LINE_SIZE = 64u;
+constexpr size_t HUGE_PAGE_SIZE = 2u * 1024u * 1024u;
+
+struct FramebufferMemoryDeleter
+{
+    size_t alignment{CACHE_LINE_SIZE};
+    void operator()(std::byte* memory) const;
+};
+
+using FramebufferMemory = std::unique_ptr<std::byte[], FramebufferMemoryDeleter>;
+
+// Number of elements per row so that every row starts on a cache line
+constexpr size_t alignedStride(const size_t width, const size_t elementSize)
+{
+    const size_t rowBytes = (width * elementSize + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+    return rowBytes / elementSize;
+}
+
+// Cache-line aligned block for a full-screen buffer. With useHugePages, allocations of at least one huge page
+// are aligned and padded to 2 MB and advised as transparent huge pages where the OS supports it, so a
+// full-screen pass touches a handful of TLB entries instead of thousands of 4 KB pages.
+FramebufferMemory allocateFramebufferMemory(size_t bytes, bool useHugePages);
+
+}
+
+#endif //FRAMEBUFFERMEMORY_H
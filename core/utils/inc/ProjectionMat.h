@@ -1,10 +1,11 @@
 #ifndef PROJECTIONMAT_H
 #define PROJECTIONMAT_H
+#include "common/inc/Vectors.hpp"
 #include "glm/mat4x4.hpp"
 namespace Utils
 {
     glm::mat4x4 makePerspectiveMat4(float fov, float aspect, float zNear, float zFar);
     glm::vec4 projectWithMat(const glm::mat4x4& projectMatrix, const glm::vec4& vec);
-    glm::mat4x4 lookAtMat(const glm::vec3& eye, const glm::vec3& target, const glm::vec3& up);
+    glm::mat4x4 lookAtMat(const vect3_t<float>& eye, const vect3_t<float>& target, const vect3_t<float>& up);
 }
 #endif //PROJECTIONMAT_H
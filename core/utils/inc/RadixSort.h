@@ -0,0 +1,34 @@
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace Utils
+{
+
+class ThreadPool;
+
+struct SortKey
+{
+    uint32_t key{0};
+    uint32_t index{0};
+};
+
+// Maps a float onto an unsigned key with the same ordering (negative values included), so floats can be
+// radix sorted on their bit pattern. Flipping the sign bit of positives and all bits of negatives does it.
+constexpr uint32_t toSortableKey(const float value)
+{
+    const auto bits = std::bit_cast<uint32_t>(value);
+    const uint32_t mask = (bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u;
+    return bits ^ mask;
+}
+
+// Stable ascending LSD radix sort on SortKey::key, 8 bits per pass. Histogram and scatter passes are
+// split across the pool when one is given; scratch is resized as needed and can be reused between calls.
+void radixSort(std::vector<SortKey>& keys, std::vector<SortKey>& scratch, ThreadPool* threadPool = nullptr);
+
+}
+
+#endif //RADIXSORT_H
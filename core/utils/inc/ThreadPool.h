@@ -0,0 +1,54 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Utils
+{
+
+// Small persistent worker pool for data-parallel loops. The calling thread takes part in the work,
+// so a pool of size N owns N - 1 worker threads. parallelFor is not re-entrant from inside a task.
+class ThreadPool
+{
+public:
+    explicit ThreadPool(size_t threadCount = std::thread::hardware_concurrency());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Number of threads that execute tasks, including the caller
+    [[nodiscard]] size_t size() const { return _workers.size() + 1; }
+
+    // Runs task(0) .. task(taskCount - 1) across the pool and blocks until all of them finished
+    void parallelFor(size_t taskCount, const std::function<void(size_t)>& task);
+
+private:
+    void workerLoop();
+    void runTasks();
+
+    std::vector<std::thread> _workers;
+    std::mutex _submitMutex;
+    std::mutex _mutex;
+    std::condition_variable _wakeCv;
+    std::condition_variable _doneCv;
+
+    const std::function<void(size_t)>* _task{nullptr};
+    std::atomic<size_t> _taskCount{0};
+    std::atomic<size_t> _nextTask{0};
+    std::atomic<size_t> _pendingTasks{0};
+    uint64_t _generation{0};
+    size_t _activeWorkers{0};
+    bool _stopping{false};
+};
+
+}
+
+#endif //THREADPOOL_H
@@ -0,0 +1,176 @@
+#include "utils/inc/ColorConversion.h"
+
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    // BT.601 limited range in 8.8 fixed point, the usual integer approximation
+    constexpr int luma(const int r, const int g, const int b) { return ((66 * r + 129 * g + 25 * b + 128) >> 8) + 16; }
+    constexpr int blueDifference(const int r, const int g, const int b) { return ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128; }
+    constexpr int redDifference(const int r, const int g, const int b) { return ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128; }
+
+    const uint32_t* rowOf(const uint32_t* pixels, const size_t pitch, const size_t y)
+    {
+        return reinterpret_cast<const uint32_t*>(reinterpret_cast<const std::byte*>(pixels) + y * pitch);
+    }
+
+    // Converts columns [x0, width) of the row pair starting at the even row y0; the pair may be a single row
+    void convertRowPairScalar(const uint32_t* pixels, const size_t width, const size_t height, const size_t pitch,
+                              const Utils::Yuv420Planes& planes, const size_t y0, const size_t x0)
+    {
+        const size_t rowCount = (y0 + 1u < height) ? 2u : 1u;
+        const size_t chromaOffset = (y0 / 2u) * Utils::yuv420ChromaWidth(width);
+
+        for (size_t x = x0; x < width; x += 2u)
+        {
+            const size_t columnCount = (x + 1u < width) ? 2u : 1u;
+            int sumR = 0;
+            int sumG = 0;
+            int sumB = 0;
+
+            for (size_t dy = 0; dy < rowCount; ++dy)
+            {
+                const uint32_t* row = rowOf(pixels, pitch, y0 + dy);
+                for (size_t dx = 0; dx < columnCount; ++dx)
+                {
+                    const uint32_t pixel = row[x + dx];
+                    const int r = static_cast<int>(pixel >> 24);
+                    const int g = static_cast<int>((pixel >> 16) & 0xFFu);
+                    const int b = static_cast<int>((pixel >> 8) & 0xFFu);
+
+                    planes.y[(y0 + dy) * width + x + dx] = static_cast<uint8_t>(luma(r, g, b));
+                    sumR += r;
+                    sumG += g;
+                    sumB += b;
+                }
+            }
+
+            const int count = static_cast<int>(rowCount * columnCount);
+            const int r = (sumR + count / 2) / count;
+            const int g = (sumG + count / 2) / count;
+            const int b = (sumB + count / 2) / count;
+            planes.u[chromaOffset + x / 2u] = static_cast<uint8_t>(blueDifference(r, g, b));
+            planes.v[chromaOffset + x / 2u] = static_cast<uint8_t>(redDifference(r, g, b));
+        }
+    }
+
+#if defined(__SSE2__)
+    // One 8-bit channel of 8 pixels, widened to 16-bit lanes
+    template <int SHIFT>
+    __m128i channel(const __m128i first, const __m128i second)
+    {
+        const __m128i mask = _mm_set1_epi32(0xFF);
+        return _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(first, SHIFT), mask),
+                               _mm_and_si128(_mm_srli_epi32(second, SHIFT), mask));
+    }
+
+    // 8 luma bytes in the low half. The weighted sum stays below 2^16, so the 16-bit lanes are read unsigned
+    __m128i lumaOf(const __m128i r, const __m128i g, const __m128i b)
+    {
+        const __m128i weighted = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(66)),
+                                                             _mm_mullo_epi16(g, _mm_set1_epi16(129))),
+                                               _mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(25)),
+                                                             _mm_set1_epi16(128)));
+        const __m128i y = _mm_add_epi16(_mm_srli_epi16(weighted, 8), _mm_set1_epi16(16));
+        return _mm_packus_epi16(y, y);
+    }
+
+    // Rounded mean of each 2x2 block: 4 results from the 8 columns of two rows, in 16-bit lanes 0..3
+    __m128i blockAverage(const __m128i top, const __m128i bottom)
+    {
+        const __m128i pairSums = _mm_madd_epi16(_mm_add_epi16(top, bottom), _mm_set1_epi16(1));
+        const __m128i average = _mm_srli_epi32(_mm_add_epi32(pairSums, _mm_set1_epi32(2)), 2);
+        return _mm_packs_epi32(average, average);
+    }
+
+    // Signed weights, each partial sum fits in 16 bits; the arithmetic shift matches >> on int
+    __m128i chromaOf(const __m128i r, const __m128i g, const __m128i b, const short wr, const short wg, const short wb)
+    {
+        const __m128i weighted = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(wr)),
+                                                             _mm_mullo_epi16(g, _mm_set1_epi16(wg))),
+                                               _mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(wb)),
+                                                             _mm_set1_epi16(128)));
+        const __m128i c = _mm_add_epi16(_mm_srai_epi16(weighted, 8), _mm_set1_epi16(128));
+        return _mm_packus_epi16(c, c);
+    }
+
+    // Converts 8 columns of two rows: 16 luma, 4 U and 4 V samples
+    void convertBlockSse2(const uint32_t* top, const uint32_t* bottom, uint8_t* yTop, uint8_t* yBottom,
+                          uint8_t* u, uint8_t* v)
+    {
+        const __m128i top0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(top));
+        const __m128i top1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(top + 4));
+        const __m128i bottom0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom));
+        const __m128i bottom1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + 4));
+
+        const __m128i rTop = channel<24>(top0, top1);
+        const __m128i gTop = channel<16>(top0, top1);
+        const __m128i bTop = channel<8>(top0, top1);
+        const __m128i rBottom = channel<24>(bottom0, bottom1);
+        const __m128i gBottom = channel<16>(bottom0, bottom1);
+        const __m128i bBottom = channel<8>(bottom0, bottom1);
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(yTop), lumaOf(rTop, gTop, bTop));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(yBottom), lumaOf(rBottom, gBottom, bBottom));
+
+        const __m128i r = blockAverage(rTop, rBottom);
+        const __m128i g = blockAverage(gTop, gBottom);
+        const __m128i b = blockAverage(bTop, bBottom);
+
+        const int uBytes = _mm_cvtsi128_si32(chromaOf(r, g, b, -38, -74, 112));
+        const int vBytes = _mm_cvtsi128_si32(chromaOf(r, g, b, 112, -94, -18));
+        std::memcpy(u, &uBytes, sizeof(uBytes));
+        std::memcpy(v, &vBytes, sizeof(vBytes));
+    }
+#endif
+}
+
+namespace Utils
+{
+
+void rgbaToYuv420Scalar(const uint32_t* pixels, const size_t width, const size_t height, const size_t pitch,
+                        const Yuv420Planes& planes)
+{
+    for (size_t y = 0; y < height; y += 2u)
+    {
+        convertRowPairScalar(pixels, width, height, pitch, planes, y, 0u);
+    }
+}
+
+void rgbaToYuv420(const uint32_t* pixels, const size_t width, const size_t height, const size_t pitch,
+                  const Yuv420Planes& planes)
+{
+#if defined(__SSE2__)
+    constexpr size_t BLOCK_WIDTH = 8u;
+    const size_t chromaWidth = yuv420ChromaWidth(width);
+    const size_t blockEnd = width - width % BLOCK_WIDTH;
+
+    for (size_t y = 0; y < height; y += 2u)
+    {
+        // Full row pairs go through the kernel, an odd last row and the columns left over are done one by one
+        size_t x = 0;
+        if (y + 1u < height)
+        {
+            const uint32_t* top = rowOf(pixels, pitch, y);
+            const uint32_t* bottom = rowOf(pixels, pitch, y + 1u);
+            uint8_t* yTop = planes.y + y * width;
+            uint8_t* u = planes.u + (y / 2u) * chromaWidth;
+            uint8_t* v = planes.v + (y / 2u) * chromaWidth;
+
+            for (; x < blockEnd; x += BLOCK_WIDTH)
+            {
+                convertBlockSse2(top + x, bottom + x, yTop + x, yTop + width + x, u + x / 2u, v + x / 2u);
+            }
+        }
+        convertRowPairScalar(pixels, width, height, pitch, planes, y, x);
+    }
+#else
+    rgbaToYuv420Scalar(pixels, width, height, pitch, planes);
+#endif
+}
+
+}
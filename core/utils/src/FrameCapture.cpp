@@ -0,0 +1,169 @@
+#include "utils/inc/FrameCapture.h"
+
+#include "common/inc/Lodepng.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <utility>
+
+namespace
+{
+    // Favors speed over file size: one fixed filter instead of trying all five per row, a short LZ77 window
+    // and no lazy matching. Output stays RGBA so lodepng never converts or scans the colors.
+    void applyFastPreset(lodepng::State& state)
+    {
+        state.info_raw.colortype = LCT_RGBA;
+        state.info_raw.bitdepth = 8;
+        state.info_png.color.colortype = LCT_RGBA;
+        state.info_png.color.bitdepth = 8;
+
+        state.encoder.auto_convert = 0;
+        state.encoder.filter_palette_zero = 0;
+        state.encoder.filter_strategy = LFS_FOUR;
+
+        state.encoder.zlibsettings.btype = 2;
+        state.encoder.zlibsettings.use_lz77 = 1;
+        state.encoder.zlibsettings.windowsize = 512;
+        state.encoder.zlibsettings.minmatch = 3;
+        state.encoder.zlibsettings.nicematch = 32;
+        state.encoder.zlibsettings.lazymatching = 0;
+    }
+}
+
+namespace Utils
+{
+
+FrameCapture::FrameCapture(std::filesystem::path directory, const size_t queueCapacity, const size_t encoderCount)
+    : _directory(std::move(directory))
+    , _frames(std::max<size_t>(queueCapacity, 1u))
+{
+    std::error_code error;
+    std::filesystem::create_directories(_directory, error);
+    if (error)
+    {
+        std::cerr << std::format("Can't create capture directory {}: {}\n", _directory.string(), error.message());
+    }
+
+    for (auto& frame : _frames)
+    {
+        _freeFrames.push_back(&frame);
+    }
+
+    const size_t threadCount = std::max<size_t>(encoderCount, 1u);
+    _encoders.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        _encoders.emplace_back([this] { encoderLoop(); });
+    }
+}
+
+FrameCapture::~FrameCapture()
+{
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+    _queuedCv.notify_all();
+
+    for (auto& encoder : _encoders)
+    {
+        encoder.join();
+    }
+}
+
+bool FrameCapture::capture(const uint32_t* pixels, const size_t width, const size_t height, const size_t pitch)
+{
+    Frame* frame{nullptr};
+    {
+        std::lock_guard lock(_mutex);
+        const uint64_t number = _nextFrameNumber++;
+        if (_freeFrames.empty())
+        {
+            _droppedFrames.fetch_add(1u, std::memory_order_relaxed);
+            return false;
+        }
+
+        frame = _freeFrames.back();
+        _freeFrames.pop_back();
+        frame->number = number;
+    }
+
+    // The copy happens outside the lock, encoders only need it for the queue
+    frame->width = width;
+    frame->height = height;
+    frame->pixels.resize(width * height);
+    for (size_t y = 0; y < height; ++y)
+    {
+        const auto* row = reinterpret_cast<const std::byte*>(pixels) + y * pitch;
+        std::memcpy(frame->pixels.data() + y * width, row, width * sizeof(uint32_t));
+    }
+
+    {
+        std::lock_guard lock(_mutex);
+        _queuedFrames.push_back(frame);
+    }
+    _queuedCv.notify_one();
+    return true;
+}
+
+void FrameCapture::encoderLoop()
+{
+    while (true)
+    {
+        Frame* frame{nullptr};
+        {
+            std::unique_lock lock(_mutex);
+            _queuedCv.wait(lock, [this] { return _stopping || !_queuedFrames.empty(); });
+
+            // Stopping still drains the queue, so every accepted frame reaches the disk
+            if (_queuedFrames.empty())
+            {
+                return;
+            }
+
+            frame = _queuedFrames.front();
+            _queuedFrames.pop_front();
+        }
+
+        encode(*frame);
+
+        {
+            std::lock_guard lock(_mutex);
+            _freeFrames.push_back(frame);
+        }
+    }
+}
+
+void FrameCapture::encode(Frame& frame)
+{
+    // 0xRRGGBBAA words sit in memory as A, B, G, R on little-endian machines, PNG wants R, G, B, A
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        std::ranges::transform(frame.pixels, frame.pixels.begin(), [](const uint32_t pixel) { return std::byteswap(pixel); });
+    }
+
+    lodepng::State state;
+    applyFastPreset(state);
+
+    std::vector<unsigned char> png;
+    const auto* bytes = reinterpret_cast<const unsigned char*>(frame.pixels.data());
+    const auto path = _directory / std::format("frame_{:06}.png", frame.number);
+
+    unsigned error = lodepng::encode(png, bytes, static_cast<unsigned>(frame.width), static_cast<unsigned>(frame.height), state);
+    if (!error)
+    {
+        error = lodepng::save_file(png, path.string());
+    }
+
+    if (error)
+    {
+        std::cerr << std::format("Can't write {}: {}\n", path.string(), lodepng_error_text(error));
+        return;
+    }
+    _writtenFrames.fetch_add(1u, std::memory_order_relaxed);
+}
+
+}
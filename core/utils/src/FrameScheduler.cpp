@@ -0,0 +1,128 @@
+#include "utils/inc/FrameScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    void cpuRelax()
+    {
+#if defined(__SSE2__)
+        _mm_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+}
+
+namespace Utils
+{
+
+FrameScheduler::FrameScheduler(const Clock::duration framePeriod, const Clock::duration spinThreshold)
+    : _framePeriod(framePeriod)
+    , _spinThreshold(spinThreshold)
+{
+}
+
+void FrameScheduler::waitUntil(const Clock::time_point deadline) const
+{
+    auto remaining = deadline - Clock::now();
+    while (remaining > _spinThreshold)
+    {
+        std::this_thread::sleep_for(remaining - _spinThreshold);
+        remaining = deadline - Clock::now();
+    }
+
+    while (Clock::now() < deadline)
+    {
+        cpuRelax();
+    }
+}
+
+FrameScheduler::Clock::duration FrameScheduler::waitForNextFrame()
+{
+    if (!_isStarted)
+    {
+        _isStarted = true;
+        _frameStart = Clock::now();
+        _nextDeadline = _frameStart + _framePeriod;
+        return _framePeriod;
+    }
+
+    waitUntil(_nextDeadline);
+
+    const auto now = Clock::now();
+    const auto frameTime = now - _frameStart;
+    _frameStart = now;
+
+    _nextDeadline += _framePeriod;
+    if (_nextDeadline < now)
+    {
+        _nextDeadline = now + _framePeriod;
+    }
+
+    const double frameMs = std::chrono::duration<double, std::milli>(frameTime).count();
+    _minMs = _frameCount == 0 ? frameMs : std::min(_minMs, frameMs);
+    _maxMs = _frameCount == 0 ? frameMs : std::max(_maxMs, frameMs);
+    _sumMs += frameMs;
+    _sumSquaresMs += frameMs * frameMs;
+    ++_frameCount;
+
+    return frameTime;
+}
+
+FrameTimeStats FrameScheduler::takeStats()
+{
+    FrameTimeStats stats;
+    if (_frameCount > 0)
+    {
+        const double count = static_cast<double>(_frameCount);
+        stats.frameCount = _frameCount;
+        stats.meanMs = _sumMs / count;
+        stats.jitterMs = std::sqrt(std::max(0.0, _sumSquaresMs / count - stats.meanMs * stats.meanMs));
+        stats.minMs = _minMs;
+        stats.maxMs = _maxMs;
+    }
+
+    _frameCount = 0;
+    _sumMs = 0.0;
+    _sumSquaresMs = 0.0;
+    return stats;
+}
+
+FixedTimestep::FixedTimestep(const std::chrono::nanoseconds step, const size_t maxStepsPerFrame)
+    : _step(step)
+    , _maxStepsPerFrame(maxStepsPerFrame)
+{
+}
+
+size_t FixedTimestep::advance(const std::chrono::nanoseconds frameTime)
+{
+    _accumulator += frameTime;
+
+    size_t steps = 0;
+    while (_accumulator >= _step && steps < _maxStepsPerFrame)
+    {
+        _accumulator -= _step;
+        ++steps;
+    }
+
+    if (_accumulator >= _step)
+    {
+        _accumulator = _accumulator % _step;
+    }
+
+    return steps;
+}
+
+float FixedTimestep::alpha() const
+{
+    return static_cast<float>(_accumulator.count()) / static_cast<float>(_step.count());
+}
+
+}
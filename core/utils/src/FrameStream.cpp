@@ -0,0 +1,192 @@
+#include "utils/inc/FrameStream.h"
+
+#include "utils/inc/ColorConversion.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <iostream>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace
+{
+    constexpr char Y4M_FRAME_HEADER[] = "FRAME\n";
+    constexpr size_t Y4M_FRAME_HEADER_SIZE = sizeof(Y4M_FRAME_HEADER) - 1u;
+}
+
+namespace Utils
+{
+
+FrameStream::FrameStream(const std::string& path, const StreamFormat format, const size_t width, const size_t height,
+                         const unsigned frameRate, const size_t bufferCount)
+    : _format(format)
+    , _width(width)
+    , _height(height)
+    , _frameBytes(format == StreamFormat::Y4M ? Y4M_FRAME_HEADER_SIZE + yuv420FrameSize(width, height)
+                                              : width * height * sizeof(uint32_t))
+    , _buffers(std::max<size_t>(bufferCount, 1u), std::vector<uint8_t>(_frameBytes))
+{
+    if (path == "-")
+    {
+        _output = stdout;
+#if defined(_WIN32)
+        // stdout starts in text mode there, which would turn every 0x0A byte of a frame into 0x0D 0x0A
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    }
+    else
+    {
+        _output = std::fopen(path.c_str(), "wb");
+        _ownsOutput = true;
+    }
+
+    if (_output == nullptr)
+    {
+        std::cerr << std::format("Can't open frame stream {}\n", path);
+        _isGood = false;
+        return;
+    }
+
+    if (_format == StreamFormat::Y4M)
+    {
+        // C420jpeg: 4:2:0 with chroma centered between the four luma samples it covers
+        const auto header = std::format("YUV4MPEG2 W{} H{} F{}:1 Ip A1:1 C420jpeg\n", _width, _height, frameRate);
+        _isGood = std::fwrite(header.data(), 1u, header.size(), _output) == header.size();
+    }
+
+    for (auto& buffer : _buffers)
+    {
+        _freeBuffers.push_back(&buffer);
+    }
+    _writer = std::thread([this] { writerLoop(); });
+}
+
+FrameStream::~FrameStream()
+{
+    if (_writer.joinable())
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _queuedCv.notify_all();
+        _writer.join();
+    }
+
+    if (_output != nullptr)
+    {
+        std::fflush(_output);
+        if (_ownsOutput)
+        {
+            std::fclose(_output);
+        }
+    }
+}
+
+bool FrameStream::isGood() const
+{
+    std::lock_guard lock(_mutex);
+    return _isGood;
+}
+
+bool FrameStream::write(const uint32_t* pixels, const size_t width, const size_t height, const size_t pitch)
+{
+    if (width != _width || height != _height)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t>* buffer{nullptr};
+    {
+        std::unique_lock lock(_mutex);
+        _freeCv.wait(lock, [this] { return !_freeBuffers.empty() || !_isGood; });
+        if (!_isGood)
+        {
+            return false;
+        }
+
+        buffer = _freeBuffers.back();
+        _freeBuffers.pop_back();
+    }
+
+    convert(pixels, pitch, *buffer);
+
+    {
+        std::lock_guard lock(_mutex);
+        _queuedBuffers.push_back(buffer);
+    }
+    _queuedCv.notify_one();
+    return true;
+}
+
+void FrameStream::convert(const uint32_t* pixels, const size_t pitch, std::vector<uint8_t>& buffer) const
+{
+    if (_format == StreamFormat::Y4M)
+    {
+        std::memcpy(buffer.data(), Y4M_FRAME_HEADER, Y4M_FRAME_HEADER_SIZE);
+
+        uint8_t* y = buffer.data() + Y4M_FRAME_HEADER_SIZE;
+        uint8_t* u = y + _width * _height;
+        uint8_t* v = u + yuv420ChromaWidth(_width) * yuv420ChromaHeight(_height);
+        rgbaToYuv420(pixels, _width, _height, pitch, {y, u, v});
+        return;
+    }
+
+    // 0xRRGGBBAA words sit in memory as A, B, G, R on little-endian machines
+    auto* destination = reinterpret_cast<uint32_t*>(buffer.data());
+    for (size_t row = 0; row < _height; ++row)
+    {
+        const auto* source = reinterpret_cast<const uint32_t*>(reinterpret_cast<const std::byte*>(pixels) + row * pitch);
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            std::transform(source, source + _width, destination + row * _width,
+                           [](const uint32_t pixel) { return std::byteswap(pixel); });
+        }
+        else
+        {
+            std::memcpy(destination + row * _width, source, _width * sizeof(uint32_t));
+        }
+    }
+}
+
+void FrameStream::writerLoop()
+{
+    while (true)
+    {
+        std::vector<uint8_t>* buffer{nullptr};
+        bool isGood{false};
+        {
+            std::unique_lock lock(_mutex);
+            _queuedCv.wait(lock, [this] { return _stopping || !_queuedBuffers.empty(); });
+            if (_queuedBuffers.empty())
+            {
+                return;
+            }
+
+            buffer = _queuedBuffers.front();
+            _queuedBuffers.pop_front();
+            isGood = _isGood;
+        }
+
+        // After a failed write the remaining frames are only recycled, the stream is already broken
+        const bool isWritten = isGood && std::fwrite(buffer->data(), 1u, buffer->size(), _output) == buffer->size();
+
+        {
+            std::lock_guard lock(_mutex);
+            _freeBuffers.push_back(buffer);
+            if (!isWritten && isGood)
+            {
+                std::cerr << "Frame stream write failed, streaming stopped\n";
+                _isGood = false;
+            }
+        }
+        _freeCv.notify_one();
+    }
+}
+
+}
@@ -0,0 +1,35 @@
+#include "utils/inc/FramebufferMemory.h"
+
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace Utils
+{
+
+void FramebufferMemoryDeleter::operator()(std::byte* memory) const
+{
+    ::operator delete[](memory, std::align_val_t{alignment});
+}
+
+FramebufferMemory allocateFramebufferMemory(const size_t bytes, const bool useHugePages)
+{
+    const size_t alignment = (useHugePages && bytes >= HUGE_PAGE_SIZE) ? HUGE_PAGE_SIZE : CACHE_LINE_SIZE;
+    const size_t paddedBytes = (bytes + alignment - 1) / alignment * alignment;
+
+    auto* memory = static_cast<std::byte*>(::operator new[](paddedBytes, std::align_val_t{alignment}));
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (alignment == HUGE_PAGE_SIZE)
+    {
+        // Only a hint: without THP support the buffer simply stays on regular pages
+        madvise(memory, paddedBytes, MADV_HUGEPAGE);
+    }
+#endif
+
+    return FramebufferMemory{memory, FramebufferMemoryDeleter{alignment}};
+}
+
+}
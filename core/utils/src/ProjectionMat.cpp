@@ -55,17 +55,17 @@ glm::vec4 projectWithMat(const glm::mat4x4& projectMatrix, const glm::vec4& vec)
     return projectedVect;
 }
 
-glm::mat4x4 lookAtMat(const glm::vec3& eye, const glm::vec3& target, const glm::vec3& up)
+glm::mat4x4 lookAtMat(const vect3_t<float>& eye, const vect3_t<float>& target, const vect3_t<float>& up)
 {
-    auto z = normalize(target - eye);
-    auto x = normalize(glm::cross(up,z));
-    auto y = cross(z, x);
+    const auto z = (target - eye).normalize();
+    const auto x = up.cross(z).normalize();
+    const auto y = z.cross(x);
 
     return {
         { x.x,  y.x,  z.x, 0.0f },
         { x.y,  y.y,  z.y, 0.0f },
         { x.z,  y.z,  z.z, 0.0f },
-        { -glm::dot(x, eye), -glm::dot(y, eye), -glm::dot(z, eye), 1.0f }
+        { -x.dot(eye), -y.dot(eye), -z.dot(eye), 1.0f }
     };
 }
 }
\ No newline at end of file
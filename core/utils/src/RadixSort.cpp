@@ -0,0 +1,111 @@
+#include "utils/inc/RadixSort.h"
+#include "utils/inc/ThreadPool.h"
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+    constexpr uint32_t RADIX_BITS = 8u;
+    constexpr size_t RADIX_BUCKETS = 1u << RADIX_BITS;
+    constexpr uint32_t RADIX_MASK = RADIX_BUCKETS - 1u;
+    constexpr uint32_t RADIX_PASSES = 32u / RADIX_BITS;
+
+    // Below this, splitting the work costs more than the sort itself
+    constexpr size_t MIN_KEYS_PER_CHUNK = 4096u;
+
+    using Histogram = std::array<size_t, RADIX_BUCKETS>;
+}
+
+namespace Utils
+{
+
+void radixSort(std::vector<SortKey>& keys, std::vector<SortKey>& scratch, ThreadPool* threadPool)
+{
+    const size_t count = keys.size();
+    if (count < 2)
+    {
+        return;
+    }
+
+    scratch.resize(count);
+
+    const size_t maxChunks = threadPool ? threadPool->size() : 1u;
+    const size_t chunkCount = std::clamp<size_t>(count / MIN_KEYS_PER_CHUNK, 1u, maxChunks);
+    const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+
+    auto forEachChunk = [&](const std::function<void(size_t)>& task)
+    {
+        if (chunkCount == 1)
+        {
+            task(0);
+            return;
+        }
+        threadPool->parallelFor(chunkCount, task);
+    };
+
+    std::vector<Histogram> histograms(chunkCount);
+    const SortKey* source = keys.data();
+    SortKey* destination = scratch.data();
+
+    for (uint32_t pass = 0; pass < RADIX_PASSES; ++pass)
+    {
+        const uint32_t shift = pass * RADIX_BITS;
+
+        forEachChunk([&](const size_t chunk)
+        {
+            auto& histogram = histograms[chunk];
+            histogram.fill(0u);
+
+            const size_t begin = chunk * chunkSize;
+            const size_t end = std::min(begin + chunkSize, count);
+            for (size_t i = begin; i < end; ++i)
+            {
+                ++histogram[(source[i].key >> shift) & RADIX_MASK];
+            }
+        });
+
+        // Turn the per-chunk counts into scatter offsets: digit-major, chunk-minor keeps the sort stable
+        size_t runningOffset = 0;
+        bool isPassTrivial = false;
+        for (size_t digit = 0; digit < RADIX_BUCKETS; ++digit)
+        {
+            const size_t digitStart = runningOffset;
+            for (auto& histogram : histograms)
+            {
+                const size_t digitCount = histogram[digit];
+                histogram[digit] = runningOffset;
+                runningOffset += digitCount;
+            }
+            isPassTrivial |= (runningOffset - digitStart) == count;
+        }
+
+        // Every key shares this digit, nothing would move
+        if (isPassTrivial)
+        {
+            continue;
+        }
+
+        forEachChunk([&](const size_t chunk)
+        {
+            auto offsets = histograms[chunk];
+
+            const size_t begin = chunk * chunkSize;
+            const size_t end = std::min(begin + chunkSize, count);
+            for (size_t i = begin; i < end; ++i)
+            {
+                destination[offsets[(source[i].key >> shift) & RADIX_MASK]++] = source[i];
+            }
+        });
+
+        source = destination;
+        destination = (destination == scratch.data()) ? keys.data() : scratch.data();
+    }
+
+    if (source != keys.data())
+    {
+        std::copy_n(source, count, keys.data());
+    }
+}
+
+}
@@ -0,0 +1,120 @@
+#include "utils/inc/ThreadPool.h"
+
+#include <algorithm>
+
+namespace Utils
+{
+
+ThreadPool::ThreadPool(const size_t threadCount)
+{
+    const size_t workerCount = std::max<size_t>(threadCount, 1u) - 1u;
+    _workers.reserve(workerCount);
+
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        _workers.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+    _wakeCv.notify_all();
+
+    for (auto& worker : _workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(const size_t taskCount, const std::function<void(size_t)>& task)
+{
+    if (taskCount == 0)
+    {
+        return;
+    }
+
+    if (_workers.empty() || taskCount == 1)
+    {
+        for (size_t i = 0; i < taskCount; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard submitLock(_submitMutex);
+    std::unique_lock lock(_mutex);
+
+    // A worker that woke late for the previous loop may still be polling the counters
+    _doneCv.wait(lock, [this] { return _activeWorkers == 0; });
+
+    _task = &task;
+    _taskCount = taskCount;
+    _pendingTasks = taskCount;
+    _nextTask = 0;
+    ++_generation;
+
+    lock.unlock();
+    _wakeCv.notify_all();
+
+    runTasks();
+
+    lock.lock();
+    _doneCv.wait(lock, [this] { return _pendingTasks == 0; });
+    _task = nullptr;
+}
+
+void ThreadPool::workerLoop()
+{
+    uint64_t seenGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock lock(_mutex);
+            _wakeCv.wait(lock, [&] { return _stopping || _generation != seenGeneration; });
+
+            if (_stopping)
+            {
+                return;
+            }
+
+            seenGeneration = _generation;
+            ++_activeWorkers;
+        }
+
+        runTasks();
+
+        {
+            std::lock_guard lock(_mutex);
+            --_activeWorkers;
+        }
+        _doneCv.notify_all();
+    }
+}
+
+void ThreadPool::runTasks()
+{
+    while (true)
+    {
+        const size_t taskIndex = _nextTask.fetch_add(1);
+        if (taskIndex >= _taskCount)
+        {
+            return;
+        }
+
+        (*_task)(taskIndex);
+
+        if (_pendingTasks.fetch_sub(1) == 1)
+        {
+            std::lock_guard lock(_mutex);
+            _doneCv.notify_all();
+        }
+    }
+}
+
+}
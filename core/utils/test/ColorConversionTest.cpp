@@ -0,0 +1,71 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <utils/inc/ColorConversion.h>
+
+#include "doctest/doctest.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Yuv420Frame
+    {
+        explicit Yuv420Frame(const size_t width, const size_t height)
+            : y(width * height)
+            , u(Utils::yuv420ChromaWidth(width) * Utils::yuv420ChromaHeight(height))
+            , v(u.size())
+        {
+        }
+
+        [[nodiscard]] Utils::Yuv420Planes planes() { return {y.data(), u.data(), v.data()}; }
+
+        std::vector<uint8_t> y;
+        std::vector<uint8_t> u;
+        std::vector<uint8_t> v;
+    };
+}
+
+TEST_CASE("Primaries convert to their BT.601 limited range values")
+{
+    constexpr uint32_t colors[] = {0x000000FFu, 0xFFFFFFFFu, 0xFF0000FFu};
+    constexpr uint8_t expected[][3] = {{16u, 128u, 128u}, {235u, 128u, 128u}, {82u, 90u, 240u}};
+
+    for (size_t i = 0; i < std::size(colors); ++i)
+    {
+        // 16 pixels wide so the SIMD path sees full blocks
+        constexpr size_t width = 16u;
+        constexpr size_t height = 2u;
+        const std::vector<uint32_t> pixels(width * height, colors[i]);
+        Yuv420Frame frame{width, height};
+        Utils::rgbaToYuv420(pixels.data(), width, height, width * sizeof(uint32_t), frame.planes());
+
+        CHECK(frame.y.front() == expected[i][0]);
+        CHECK(frame.y.back() == expected[i][0]);
+        CHECK(frame.u.front() == expected[i][1]);
+        CHECK(frame.v.back() == expected[i][2]);
+    }
+}
+
+TEST_CASE("SIMD conversion matches the scalar reference, odd edges and row padding included")
+{
+    std::mt19937 random{7u};
+    for (const auto& [width, height] : {std::pair<size_t, size_t>{64u, 32u}, {37u, 21u}, {8u, 1u}, {3u, 3u}})
+    {
+        const size_t stride = width + 5u;
+        std::vector<uint32_t> pixels(stride * height);
+        for (auto& pixel : pixels)
+        {
+            pixel = static_cast<uint32_t>(random());
+        }
+
+        Yuv420Frame reference{width, height};
+        Yuv420Frame converted{width, height};
+        Utils::rgbaToYuv420Scalar(pixels.data(), width, height, stride * sizeof(uint32_t), reference.planes());
+        Utils::rgbaToYuv420(pixels.data(), width, height, stride * sizeof(uint32_t), converted.planes());
+
+        CHECK(converted.y == reference.y);
+        CHECK(converted.u == reference.u);
+        CHECK(converted.v == reference.v);
+    }
+}
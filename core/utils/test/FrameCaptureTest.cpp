@@ -0,0 +1,62 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <common/inc/Lodepng.h>
+#include <utils/inc/FrameCapture.h>
+
+#include "doctest/doctest.h"
+
+#include <filesystem>
+#include <vector>
+
+TEST_CASE("Captured frames decode back to the same RGBA pixels")
+{
+    const auto directory = std::filesystem::temp_directory_path() / "FrameCaptureTest";
+    std::filesystem::remove_all(directory);
+
+    // Rows padded past the width like a locked texture, the padding must not leak into the image
+    constexpr size_t width = 5u;
+    constexpr size_t height = 3u;
+    constexpr size_t stride = 8u;
+    std::vector<uint32_t> pixels(stride * height, 0xDEADBEEFu);
+    for (size_t y = 0; y < height; ++y)
+    {
+        for (size_t x = 0; x < width; ++x)
+        {
+            pixels[y * stride + x] = 0x10203000u | static_cast<uint32_t>(y * width + x);
+        }
+    }
+
+    {
+        Utils::FrameCapture frameCapture{directory, 2u, 1u};
+        CHECK(frameCapture.capture(pixels.data(), width, height, stride * sizeof(uint32_t)));
+    }
+
+    std::vector<std::filesystem::path> written;
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        written.push_back(entry.path());
+    }
+    REQUIRE(written.size() == 1u);
+    CHECK(written.front().extension() == ".png");
+
+    std::vector<unsigned char> decoded;
+    unsigned decodedWidth = 0;
+    unsigned decodedHeight = 0;
+    REQUIRE(lodepng::decode(decoded, decodedWidth, decodedHeight, written.front().string()) == 0u);
+    REQUIRE(decodedWidth == width);
+    REQUIRE(decodedHeight == height);
+
+    for (size_t y = 0; y < height; ++y)
+    {
+        for (size_t x = 0; x < width; ++x)
+        {
+            const unsigned char* rgba = decoded.data() + (y * width + x) * 4u;
+            CHECK(rgba[0] == 0x10u);
+            CHECK(rgba[1] == 0x20u);
+            CHECK(rgba[2] == 0x30u);
+            CHECK(rgba[3] == y * width + x);
+        }
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,68 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <utils/inc/FrameRing.h>
+
+#include "doctest/doctest.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Frame
+    {
+        int input{0};
+        int output{0};
+    };
+
+    void runWorker(Utils::FrameRing<Frame>& ring)
+    {
+        while (Frame* frame = ring.beginProcess())
+        {
+            frame->output = frame->input * 2;
+            ring.finishProcess();
+        }
+    }
+}
+
+TEST_CASE("Frames come back processed and in submission order with one frame in flight")
+{
+    Utils::FrameRing<Frame> ring;
+    std::thread worker{runWorker, std::ref(ring)};
+
+    std::vector<int> consumed;
+    constexpr int frameCount = 1000;
+    for (int frame = 0; frame < frameCount; ++frame)
+    {
+        ring.beginSubmit().input = frame;
+        ring.submit();
+
+        // Keep the next frame in flight like the pipelined main loop does
+        if (frame > 0)
+        {
+            consumed.push_back(ring.beginConsume().output);
+            ring.finishConsume();
+        }
+    }
+    consumed.push_back(ring.beginConsume().output);
+    ring.finishConsume();
+
+    ring.stop();
+    worker.join();
+
+    REQUIRE(consumed.size() == frameCount);
+    for (int frame = 0; frame < frameCount; ++frame)
+    {
+        CHECK(consumed[frame] == frame * 2);
+    }
+}
+
+TEST_CASE("Stop releases an idle worker")
+{
+    Utils::FrameRing<Frame> ring;
+    std::thread worker{runWorker, std::ref(ring)};
+
+    ring.stop();
+    worker.join();
+    CHECK(true);
+}
@@ -0,0 +1,51 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <utils/inc/FrameScheduler.h>
+
+#include "doctest/doctest.h"
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Fixed timestep consumes whole steps and keeps the remainder")
+{
+    Utils::FixedTimestep simulationClock{10ms};
+
+    CHECK(simulationClock.advance(25ms) == 2u);
+    CHECK(simulationClock.alpha() == doctest::Approx(0.5f));
+
+    CHECK(simulationClock.advance(5ms) == 1u);
+    CHECK(simulationClock.alpha() == doctest::Approx(0.0f));
+
+    CHECK(simulationClock.advance(3ms) == 0u);
+    CHECK(simulationClock.alpha() == doctest::Approx(0.3f));
+}
+
+TEST_CASE("Fixed timestep drops time beyond the step limit")
+{
+    Utils::FixedTimestep simulationClock{10ms, 3u};
+
+    CHECK(simulationClock.advance(1000ms + 4ms) == 3u);
+    CHECK(simulationClock.alpha() == doctest::Approx(0.4f));
+    CHECK(simulationClock.advance(0ms) == 0u);
+}
+
+TEST_CASE("Frames never start before their deadline")
+{
+    constexpr auto period = 3ms;
+    Utils::FrameScheduler frameScheduler{period, 500us};
+
+    const auto start = Utils::FrameScheduler::Clock::now();
+    frameScheduler.waitForNextFrame();
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        CHECK(frameScheduler.waitForNextFrame() > 0ns);
+    }
+    const auto elapsed = Utils::FrameScheduler::Clock::now() - start;
+
+    const auto stats = frameScheduler.takeStats();
+    CHECK(stats.frameCount == 10u);
+    CHECK(elapsed >= 10 * period);
+    CHECK(stats.minMs > 0.0);
+    CHECK(stats.maxMs >= stats.meanMs);
+    CHECK(frameScheduler.takeStats().frameCount == 0u);
+}
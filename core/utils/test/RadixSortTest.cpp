@@ -0,0 +1,98 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <utils/inc/RadixSort.h>
+#include <utils/inc/ThreadPool.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "doctest/doctest.h"
+
+namespace
+{
+    std::vector<Utils::SortKey> makeDepthKeys(const size_t count, const uint32_t seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> depth(-50.0f, 100.0f);
+
+        std::vector<Utils::SortKey> keys(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            keys[i] = {Utils::toSortableKey(depth(generator)), static_cast<uint32_t>(i)};
+        }
+        return keys;
+    }
+
+    bool isSortedAndStable(const std::vector<Utils::SortKey>& keys)
+    {
+        return std::ranges::is_sorted(keys, [](const auto& first, const auto& second)
+        {
+            return first.key != second.key ? first.key < second.key : first.index < second.index;
+        });
+    }
+}
+
+TEST_CASE("Sortable key preserves float ordering")
+{
+    const std::vector<float> ascending{-1000.0f, -2.5f, -0.0f, 0.0f, 1e-6f, 0.5f, 3.0f, 1e9f};
+
+    for (size_t i = 1; i < ascending.size(); ++i)
+    {
+        CHECK(Utils::toSortableKey(ascending[i - 1]) <= Utils::toSortableKey(ascending[i]));
+    }
+    CHECK(Utils::toSortableKey(-2.5f) < Utils::toSortableKey(0.5f));
+}
+
+TEST_CASE("Radix sort single threaded")
+{
+    std::vector<Utils::SortKey> scratch;
+
+    SUBCASE("Empty and single element are untouched")
+    {
+        std::vector<Utils::SortKey> empty;
+        Utils::radixSort(empty, scratch);
+        CHECK(empty.empty());
+
+        std::vector<Utils::SortKey> single{{42u, 7u}};
+        Utils::radixSort(single, scratch);
+        CHECK(single[0].key == 42u);
+        CHECK(single[0].index == 7u);
+    }
+
+    SUBCASE("Random depths end up ascending")
+    {
+        auto keys = makeDepthKeys(1000, 1u);
+        Utils::radixSort(keys, scratch);
+        CHECK(isSortedAndStable(keys));
+    }
+
+    SUBCASE("Equal keys keep their input order")
+    {
+        std::vector<Utils::SortKey> keys;
+        for (uint32_t i = 0; i < 300; ++i)
+        {
+            keys.push_back({i % 3u, i});
+        }
+        Utils::radixSort(keys, scratch);
+        CHECK(isSortedAndStable(keys));
+    }
+}
+
+TEST_CASE("Radix sort across a thread pool matches std::stable_sort")
+{
+    Utils::ThreadPool threadPool(4);
+    std::vector<Utils::SortKey> scratch;
+
+    auto keys = makeDepthKeys(100000, 2u);
+    auto expected = keys;
+    std::ranges::stable_sort(expected, {}, &Utils::SortKey::key);
+
+    Utils::radixSort(keys, scratch, &threadPool);
+
+    REQUIRE(keys.size() == expected.size());
+    CHECK(std::ranges::equal(keys, expected, [](const auto& first, const auto& second)
+    {
+        return first.key == second.key && first.index == second.index;
+    }));
+}
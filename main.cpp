@@ -1,9 +1,20 @@
 #include <algorithm>
-#include <cstring>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <filesystem>
 #include <format>
 #include <fstream>
 #include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -13,90 +24,105 @@
 #include "common/inc/CommonDefines.h"
 #include "common/inc/Vectors.hpp"
 
-#include "graphics/light/inc/light.h"
+#include "graphics/pipeline/inc/GeometryStage.h"
+#include "graphics/pipeline/inc/RasterStage.h"
+#include "graphics/rendering/inc/DepthBuffer.h"
+#include "graphics/rendering/inc/DepthOrdering.h"
 #include "graphics/rendering/inc/Display.h"
+#include "graphics/rendering/inc/DynamicResolution.h"
+#include "graphics/rendering/inc/RenderTarget.h"
+#include "graphics/scene/inc/Scene.h"
 #include "graphics/shapes/inc/Mesh.h"
-#include "utils/inc/ProjectionMat.h"
+#include "utils/inc/FrameCapture.h"
+#include "utils/inc/FrameRing.h"
+#include "utils/inc/FrameStream.h"
+#include "utils/inc/FrameScheduler.h"
+#include "utils/inc/ThreadPool.h"
 
-#include <glm/gtc/matrix_transform.hpp>
-
-#include "common/inc/Lodepng.h"
-#include "core/graphics/camera/inc/Camera.h"
-#include "graphics/clipping/inc/Clipping.h"
 #include "logger/LogHelper.h"
 
 namespace
 {
-    Camera camera;
-    std::vector<Triangle> trianglesToRender;
-    Mesh globalMesh;
-    Texture2dArray textureMesh;
-    glm::mat4x4 projectionMat{0};
-    ZBufferArray zBuffer;
-    std::unique_ptr<Frustum> frustum;
-
-    enum VertexPoint : size_t
-    {
-        A,
-        B,
-        C
-    };
+    Render::CameraControls cameraControls;
+    Scene scene;
+    std::unique_ptr<Utils::ThreadPool> threadPool;
+    std::unique_ptr<Render::GeometryStage> geometryStage;
+
+    constexpr float Z_NEAR = 0.1f;
+    constexpr float Z_FAR = 100.0f;
 
+    constexpr float FOV_Y = glm::radians(60.0f);
 
-    enum class RenderingStates : uint8_t
+    struct Resolution
     {
-        WIREFRAME_WITH_VERTICES = 1U,           // Displays a wireframe with small red dots at each triangle vertex
-        WIREFRAME_ONLY,                        // Displays only the wireframe lines
-        FILLED_TRIANGLES,                     // Displays filled triangles with a solid color
-        FILLED_TRIANGLES_WITH_WIREFRAME,     // Displays both filled triangles and wireframe lines
-        TEXTURED_TRIANGLES,                 // Displays textured triangles
-        TEXTURED_TRIANGLES_WITH_WIREFRAME, // Displays both textured triangles and wireframe lines
+        size_t width{WINDOW_WIDTH};
+        size_t height{WINDOW_HEIGHT};
     };
 
+    // Internal resolutions cycled with R, the window keeps its size and the frame is scaled to it
+    constexpr std::array<Resolution, 5> RESOLUTION_PRESETS{{
+        {1920u, 1080u}, {1600u, 900u}, {1280u, 720u}, {960u, 540u}, {640u, 360u}
+    }};
+    size_t resolutionPresetIndex{0};
+
+    // Input only records the requests, they are applied between frames where the texture can be recreated
+    std::optional<Resolution> requestedResolution;
+    Render::DepthFormat requestedDepthFormat{Render::DepthFormat::FLOAT};
+
+    constexpr auto FRAME_PERIOD = std::chrono::nanoseconds{std::chrono::seconds{1}} / TARGETED_FRAME_RATE;
+    constexpr auto FRAME_STATS_INTERVAL = std::chrono::seconds{1};
+
+    Utils::FrameScheduler frameScheduler{FRAME_PERIOD};
+
+    // Scales the render size under the target capacity to hold the raster stage within the frame budget
+    Render::DynamicResolution dynamicResolution{1000.0f / TARGETED_FRAME_RATE};
+
+    using Render::RenderingStates;
+
     bool isBackFaceCullingEnabled{false};
+    bool isEarlyZOrderingEnabled{true};
+    bool isDynamicResolutionEnabled{false};
+    bool isPipelineEnabled{false};
+    bool isZeroCopyPresentEnabled{true};
+    bool isCaptureEnabled{false};
     RenderingStates renderingState{RenderingStates::TEXTURED_TRIANGLES};
 
-    constexpr vect3_t<float> ROTATION{-0.2f, 0.0f, 0.0f};
+    // One frame on its way through the pipeline: the settings it was submitted with and its geometry
+    struct FrameSlot
+    {
+        Render::GeometryInput input;
+        RenderingStates renderingState{RenderingStates::TEXTURED_TRIANGLES};
+        Render::FrameGeometry geometry;
+    };
 
-}
+    // Two slots: the geometry thread fills one while the main thread rasterizes and presents the other
+    Utils::FrameRing<FrameSlot> frameRing;
+    size_t framesInFlight{0};
 
+    // Raster stage time of the frame drawn last, what the render scale changes; empty until a frame is drawn
+    std::optional<Utils::FrameScheduler::Clock::duration> rasterTime;
 
-std::vector<uint32_t> LoadPngToSDLExpectedFormat(const std::string& filePath, int& width, int& height)
-{
-    std::vector<unsigned char> image;
-    unsigned w, h;
+    // Time spent handing frames to SDL (upload or unlock, copy and present) since the last stats report
+    Utils::FrameScheduler::Clock::duration presentTime{0};
+    size_t presentedFrames{0};
 
-    unsigned error = lodepng::decode(image, w, h, filePath, LodePNGColorType::LCT_RGBA);
-    if (error)
-    {
-        throw std::runtime_error("LodePNG load error " + std::to_string(error) + ": " + lodepng_error_text(error));
-    }
+    // PNG sequence of the presented frames, created on the first capture
+    std::filesystem::path captureDirectory{"captures"};
+    std::unique_ptr<Utils::FrameCapture> frameCapture;
 
-    width = static_cast<int>(w);
-    height = static_cast<int>(h);
-    const size_t pixelCount = static_cast<size_t>(width) * height;
-    std::vector<uint32_t> result;
-    result.reserve(pixelCount);
+    // Raw video of the presented frames for an external encoder, opened at launch
+    std::optional<std::string> streamPath;
+    Utils::StreamFormat streamFormat{Utils::StreamFormat::Y4M};
+    std::unique_ptr<Utils::FrameStream> frameStream;
 
-    for (size_t i = 0; i < pixelCount; ++i)
-    {
-        constexpr size_t C_CH_OFFSET{3u};
-        constexpr size_t B_CH_OFFSET{2u};
-        constexpr size_t G_CH_OFFSET{1u};
-        constexpr size_t R_CH_OFFSET{0u};
-        constexpr int numberOfChannels = 4;
-
-        const uint8_t r = image[i * numberOfChannels + R_CH_OFFSET];
-        const uint8_t g = image[i * numberOfChannels + G_CH_OFFSET];
-        const uint8_t b = image[i * numberOfChannels + B_CH_OFFSET];
-        const uint8_t a = image[i * numberOfChannels + C_CH_OFFSET];
-
-        result.push_back((r << 24) | (g << 16) | (b << 8) | a);
-    }
+    // Assets placed side by side in the scene, the cube when none is given
+    std::vector<std::string> sceneAssets;
+    // Copies of each asset, all drawing its one mesh and texture
+    size_t instancesPerAsset{1};
 
-    return result;
 }
 
+
 int InitWindow(SDL_Renderer*& renderer, SDL_Window*& window)
 {
     if (SDL_Init(SDL_INIT_EVERYTHING) != 0)
@@ -136,18 +162,18 @@ void handleMovement(const SDL_Keycode key, const bool pressed)
 
     switch (key)
     {
-        case SDLK_w: camera._velocity.x = move; break;
-        case SDLK_s: camera._velocity.x = -move; break;
+        case SDLK_w: cameraControls.velocity.x = move; break;
+        case SDLK_s: cameraControls.velocity.x = -move; break;
 
             // If UP/DOWN feel inverted, swap these:
-        case SDLK_UP:   camera._velocity.y = -move; break;
-        case SDLK_DOWN: camera._velocity.y =  move; break;
+        case SDLK_UP:   cameraControls.velocity.y = -move; break;
+        case SDLK_DOWN: cameraControls.velocity.y =  move; break;
 
             // If LEFT/RIGHT feel inverted, swap these:
-        case SDLK_a: camera._yaw =  rot; break;
-        case SDLK_d: camera._yaw = -rot; break;
-        case SDLK_q: camera._pitch = rot; break;
-        case SDLK_e: camera._pitch = -rot; break;
+        case SDLK_a: cameraControls.yaw =  rot; break;
+        case SDLK_d: cameraControls.yaw = -rot; break;
+        case SDLK_q: cameraControls.pitch = rot; break;
+        case SDLK_e: cameraControls.pitch = -rot; break;
 
         default: break;
     }
@@ -164,8 +190,32 @@ void handleControlKey(const SDL_Keycode key, bool& isQuitEvent)
         case SDLK_4: renderingState = RenderingStates::FILLED_TRIANGLES_WITH_WIREFRAME; break;
         case SDLK_5: renderingState = RenderingStates::TEXTURED_TRIANGLES; break;
         case SDLK_6: renderingState = RenderingStates::TEXTURED_TRIANGLES_WITH_WIREFRAME; break;
+        case SDLK_7: renderingState = RenderingStates::ANTIALIASED_WIREFRAME; break;
         case SDLK_c: isBackFaceCullingEnabled = true; break;
         case SDLK_v: isBackFaceCullingEnabled = false; break;
+        case SDLK_z: isEarlyZOrderingEnabled = true; break;
+        case SDLK_x: isEarlyZOrderingEnabled = false; break;
+        case SDLK_F1: requestedDepthFormat = Render::DepthFormat::FLOAT; break;
+        case SDLK_F2: requestedDepthFormat = Render::DepthFormat::REVERSED_FLOAT; break;
+        case SDLK_F3: requestedDepthFormat = Render::DepthFormat::UNORM16; break;
+        case SDLK_F4: requestedDepthFormat = Render::DepthFormat::UNORM24; break;
+        case SDLK_r:
+            // A video stream is fixed to the size it was opened with
+            if (frameStream)
+            {
+                std::cerr << "The resolution can't change while streaming frames" << std::endl;
+                break;
+            }
+            resolutionPresetIndex = (resolutionPresetIndex + 1) % RESOLUTION_PRESETS.size();
+            requestedResolution = RESOLUTION_PRESETS[resolutionPresetIndex];
+            break;
+        case SDLK_t:
+            isDynamicResolutionEnabled = !isDynamicResolutionEnabled;
+            dynamicResolution.reset();
+            break;
+        case SDLK_p: isPipelineEnabled = !isPipelineEnabled; break;
+        case SDLK_u: isZeroCopyPresentEnabled = !isZeroCopyPresentEnabled; break;
+        case SDLK_F12: isCaptureEnabled = !isCaptureEnabled; break;
         case SDLK_ESCAPE: isQuitEvent = true; break;
         default: break;
     }
@@ -208,254 +258,365 @@ void processInput(bool& isQuitEvent)
     }
 }
 
-void update()
+// Hands the settings of the next frame to the geometry thread
+void submitFrame(const Render::RenderTarget& renderTarget, const std::chrono::nanoseconds frameTime)
 {
-    static Uint64 prevFrameTime;
-    const auto currentFrameTime = SDL_GetTicks64();
-    const auto deltaTime = currentFrameTime - prevFrameTime;
-    const auto deltaTimeSec = deltaTime * 0.001f;
-    const auto timeToWait = FRAME_TIME - deltaTime;
+    FrameSlot& frame = frameRing.beginSubmit();
+
+    // With a z-buffer, nearest-first ordering lets the depth test reject occluded texels before they are fetched
+    const auto depthOrder = Render::drawOrder(renderingState, isEarlyZOrderingEnabled);
+
+    frame.input = Render::GeometryInput{
+        .frameTime = frameTime,
+        .cameraControls = cameraControls,
+        .targetWidth = renderTarget.width(),
+        .targetHeight = renderTarget.height(),
+        .aspectRatio = renderTarget.aspectRatio(),
+        .isBackFaceCullingEnabled = isBackFaceCullingEnabled,
+        .depthOrder = depthOrder,
+    };
+    frame.renderingState = renderingState;
 
-    trianglesToRender.clear();
+    frameRing.submit();
+    ++framesInFlight;
+}
 
-    if (timeToWait > 0 && timeToWait <=FRAME_TIME)
+void runGeometryStage()
+{
+    while (FrameSlot* frame = frameRing.beginProcess())
     {
-        SDL_Delay(timeToWait);
+        geometryStage->process(frame->input, frame->geometry);
+        frameRing.finishProcess();
     }
+}
 
-    prevFrameTime = SDL_GetTicks64();
-    // globalMesh.rotation.x += ROTATION.x;
-    // globalMesh.rotation.y += ROTATION.y;
-    // globalMesh.rotation.z += ROTATION.z;
-    globalMesh.translation.z = 4.0f;
-
-    //Create the view matrix
-    auto target = glm::vec3(0.0f,0.0f,1.0f);
-    camera.updateTick(deltaTimeSec,target);
-    glm::mat4x4 viewMat = Utils::lookAtMat(to_glm(camera._position),target,{0,1,0});
-
+// Rasterizes and presents the oldest submitted frame, waiting for its geometry if it is not done yet
+void render(SDL_Renderer*& renderer, Render::RenderTarget& renderTarget, SDL_Texture*& colorBufferTexture)
+{
+    const FrameSlot& frame = frameRing.beginConsume();
+
+    // The frame is drawn at the size it was projected for, the target may have been scaled since
+    renderTarget.setRenderSize(frame.input.targetWidth, frame.input.targetHeight);
+    auto& colorBuffer = renderTarget.color();
+
+    // Only the rendered part of the texture is used, the renderer stretches it over the window
+    const SDL_Rect renderedArea{0, 0, static_cast<int>(colorBuffer.width()), static_cast<int>(colorBuffer.height())};
+
+    // Zero-copy: rasterize straight into the locked texture memory at its pitch. If the lock fails the frame
+    // is drawn into the color buffer's own memory and uploaded as before
+    void* lockedPixels{nullptr};
+    int lockedPitch{0};
+    const bool isDrawingIntoTexture = isZeroCopyPresentEnabled
+                                   && SDL_LockTexture(colorBufferTexture, &renderedArea, &lockedPixels, &lockedPitch) == 0;
+    if (isDrawingIntoTexture)
+    {
+        colorBuffer.attach(static_cast<uint32_t*>(lockedPixels), static_cast<size_t>(lockedPitch));
+    }
 
-    static auto offsetIndex = [](const int index){return index - 1;};
-    for (const auto& [aFaceVert, bFaceVert, cFaceVert, meshColor, a_uv,b_uv,c_uv] : globalMesh.faces) {
-        std::array<vect3_t<float>,3> faceVert{{
-            globalMesh.vertices[offsetIndex(aFaceVert)],
-            globalMesh.vertices[offsetIndex(bFaceVert)],
-            globalMesh.vertices[offsetIndex(cFaceVert)]
-        }};
+    auto renderColorBuffer = [&]()
+    {
+      // Untouched tiles still hold stale pixels, fill them before the texture is used
+      colorBuffer.resolve(threadPool.get());
+
+      if (isCaptureEnabled)
+      {
+          if (!frameCapture)
+          {
+              frameCapture = std::make_unique<Utils::FrameCapture>(captureDirectory);
+          }
+          frameCapture->capture(colorBuffer.data(), colorBuffer.width(), colorBuffer.height(), colorBuffer.pitch());
+      }
+
+      // A stream that stops taking frames is closed rather than silently left behind
+      if (frameStream
+          && !frameStream->write(colorBuffer.data(), colorBuffer.width(), colorBuffer.height(), colorBuffer.pitch()))
+      {
+          std::cerr << "Frame stream closed, no further frames are written" << std::endl;
+          frameStream.reset();
+      }
+
+      const auto presentStart = Utils::FrameScheduler::Clock::now();
+      if (isDrawingIntoTexture)
+      {
+          colorBuffer.detach();
+          SDL_UnlockTexture(colorBufferTexture);
+      }
+      else
+      {
+          SDL_UpdateTexture(colorBufferTexture, &renderedArea, colorBuffer.data(), static_cast<int>(colorBuffer.pitch()));
+      }
+      SDL_RenderCopy(renderer, colorBufferTexture, &renderedArea, nullptr);
+      SDL_RenderPresent(renderer);
+      presentTime += Utils::FrameScheduler::Clock::now() - presentStart;
+      ++presentedFrames;
+    };
 
-        std::array<vect3_t<float>,3> transformedVertices{};
+    const auto rasterStart = Utils::FrameScheduler::Clock::now();
+    Render::rasterizeFrame(frame.geometry, frame.renderingState, scene.textures(), renderTarget);
+    rasterTime = Utils::FrameScheduler::Clock::now() - rasterStart;
+    renderColorBuffer();
+    renderTarget.clear();
 
-        //Transform
-        std::ranges::transform(faceVert, transformedVertices.begin(),
-            [&viewMat](const auto& vert)
-            {
-                const glm::vec4 vertHomogeneous(vert.x, vert.y, vert.z, 1.0f);
-
-                // Scale
-                const glm::mat4 scaleMatrix = glm::scale(glm::mat4(1.0f),
-                    glm::vec3(globalMesh.scale.x,
-                              globalMesh.scale.y,
-                              globalMesh.scale.z));
-
-                // Rotation (X → Y → Z)
-                const glm::mat4 rotationMatrix =
-                    glm::rotate(glm::mat4(1.0f), glm::radians(globalMesh.rotation.x), glm::vec3(1, 0, 0)) *
-                    glm::rotate(glm::mat4(1.0f), glm::radians(globalMesh.rotation.y), glm::vec3(0, 1, 0)) *
-                    glm::rotate(glm::mat4(1.0f), glm::radians(globalMesh.rotation.z), glm::vec3(0, 0, 1));
-
-                // Translation
-                const glm::mat4 translationMatrix = glm::translate(glm::mat4(1.0f),
-                    glm::vec3(globalMesh.translation.x,
-                              globalMesh.translation.y,
-                              globalMesh.translation.z));
-
-                // World matrix (T * R * S)
-                const glm::mat4 worldMatrix = translationMatrix * rotationMatrix * scaleMatrix;
-
-                // Apply world, then view
-                const glm::vec4 transformedVert = viewMat * worldMatrix * vertHomogeneous;
-
-                return vect3_t<float>(transformedVert.x,
-                                      transformedVert.y,
-                                      transformedVert.z);
-            });
-
-        auto isRenderTriangle{true};
-        //Culling
-        auto vectorAB =  transformedVertices[VertexPoint::B] - transformedVertices[VertexPoint::A];
-        auto vectorAC =  transformedVertices[VertexPoint::C] - transformedVertices[VertexPoint::A];
-        vect3_t<float> origin{0.0f, 0.0f, 0.0f};
-        auto cameraVector =  origin - transformedVertices[VertexPoint::A];
-        auto faceNormal = vectorAB.cross(vectorAC).normalize();
-        const auto projectionNormal = faceNormal.dot(cameraVector);
-
-        if (isBackFaceCullingEnabled)
-        {
-            isRenderTriangle = projectionNormal >= -std::numeric_limits<float>::epsilon();
-        }
+    frameRing.finishConsume();
+    --framesInFlight;
 
-        Polygon polygon{transformedVertices, {{{a_uv},{b_uv},{c_uv}}}};
-        auto clippedPolygon = frustum->ClipPolygon(polygon);
-        auto trianglesAfterClipping = clippedPolygon.polygon2Triangles();
-        auto clipedTexturesTriangles = clippedPolygon.polygon2TrianglesTex();
+}
 
-        const size_t triCount = std::min(trianglesAfterClipping.size(), clipedTexturesTriangles.size());
+SDL_Texture* createColorBufferTexture(SDL_Renderer* renderer, const Render::RenderTarget& renderTarget)
+{
+    // Sized for the capacity, a dynamically scaled frame uses its top-left corner
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR32, SDL_TEXTUREACCESS_STREAMING,
+                                             static_cast<int>(renderTarget.capacityWidth()),
+                                             static_cast<int>(renderTarget.capacityHeight()));
+    SDL_SetTextureScaleMode(texture, SDL_ScaleModeLinear);
+    return texture;
+}
 
-        auto projectTriangle = [&](const std::array<vect3_t<float>,3>& triangleToProject,
-                                   const std::array<Texture2d,3>& uvToProject)
-        {
-            Triangle projectedTriangle;
-            const auto& globalLight {getGlobalLight()};
-            const float lightIntensity = -faceNormal.dot(globalLight._direction);
-            projectedTriangle._color = applyIntensityToColor(meshColor, lightIntensity);
+// Resizes the next frame from the raster cost of the one just drawn. Geometry, present and the wait for the
+// next frame do not change with the render size, so they are left out of what the controller sees.
+void updateDynamicResolution(Render::RenderTarget& renderTarget)
+{
+    const auto drawnRasterTime = std::exchange(rasterTime, std::nullopt);
 
-            // IMPORTANT: use UVs generated by clipping (matches triangleToProject)
-            projectedTriangle.textCoord = uvToProject;
+    // A video stream cannot change size, it needs every frame at the full target size
+    if (!isDynamicResolutionEnabled || frameStream)
+    {
+        renderTarget.setRenderSize(renderTarget.capacityWidth(), renderTarget.capacityHeight());
+        return;
+    }
 
-            projectedTriangle.setAvgDepth(
-                (triangleToProject[0].z + triangleToProject[1].z + triangleToProject[2].z) / 3.0f
-            );
+    // Nothing was drawn, the first pipelined iteration only submits
+    if (!drawnRasterTime)
+    {
+        return;
+    }
 
-            std::ranges::transform(triangleToProject, projectedTriangle._points.begin(),
-                [](const vect3_t<float>& vert)
-                {
-                    auto res = Utils::projectWithMat(projectionMat, {vert.x, vert.y, vert.z, 1});
+    const float rasterCostMs = std::chrono::duration<float, std::milli>(*drawnRasterTime).count();
+    const float scale = dynamicResolution.update(rasterCostMs);
 
-                    res.x *= WINDOW_WIDTH / 2.0f;
-                    res.y *= WINDOW_HEIGHT / 2.0f;
+    renderTarget.setRenderSize(Render::DynamicResolution::scaleDimension(renderTarget.capacityWidth(), scale),
+                               Render::DynamicResolution::scaleDimension(renderTarget.capacityHeight(), scale));
+}
 
-                    // Flip the Y axis because the model is loaded with y up
-                    res.y *= -1.0f;
+// Frames still in flight were projected for the old target, they are dropped rather than drawn
+void discardFramesInFlight()
+{
+    for (; framesInFlight > 0; --framesInFlight)
+    {
+        frameRing.beginConsume();
+        frameRing.finishConsume();
+    }
+}
 
-                    res.x += WINDOW_WIDTH / 2.0f;
-                    res.y += WINDOW_HEIGHT / 2.0f;
-                    return res;
-                });
+void applyRenderTargetRequests(SDL_Renderer* renderer, Render::RenderTarget& renderTarget, SDL_Texture*& colorBufferTexture)
+{
+    renderTarget.setDepthFormat(requestedDepthFormat);
 
-            trianglesToRender.push_back(projectedTriangle);
-        };
+    if (requestedResolution)
+    {
+        discardFramesInFlight();
+        renderTarget.resize(requestedResolution->width, requestedResolution->height);
+        dynamicResolution.reset();
 
-        // Projection to screen space
-        if (isRenderTriangle)
-        {
-            for (size_t i = 0; i < triCount; ++i)
-            {
-                projectTriangle(trianglesAfterClipping[i], clipedTexturesTriangles[i]);
-            }
-        }
+        SDL_DestroyTexture(colorBufferTexture);
+        colorBufferTexture = createColorBufferTexture(renderer, renderTarget);
+        requestedResolution.reset();
     }
+}
 
-    std::ranges::sort(trianglesToRender, [](auto& firstTriangle, auto& secondTriangle)
+// Frame time and its jitter over the last interval, plus the average present cost, in the window title
+// and the debug log
+void reportFrameStats(SDL_Window* window, const Utils::FrameTimeStats& stats, const Render::RenderTarget& renderTarget)
+{
+    const double presentMs = presentedFrames > 0
+                               ? std::chrono::duration<double, std::milli>(presentTime).count() / static_cast<double>(presentedFrames)
+                               : 0.0;
+    presentTime = {};
+    presentedFrames = 0;
+
+    const auto report = std::format("{:.2f} ms (jitter {:.3f} ms, min {:.2f}, max {:.2f}) at {}x{}, present {:.2f} ms ({})",
+                                    stats.meanMs, stats.jitterMs, stats.minMs, stats.maxMs,
+                                    renderTarget.width(), renderTarget.height(),
+                                    presentMs, isZeroCopyPresentEnabled ? "zero-copy" : "upload");
+    SDL_SetWindowTitle(window, std::format("SDL2 Application - {}", report).c_str());
+    DEBUG_LOG("Frame time {}", report);
+
+    if (frameCapture)
     {
-        return firstTriangle.getAvgDepth() > secondTriangle.getAvgDepth();
-    });
-
+        DEBUG_LOG("Captured {} frames into {}, {} dropped", frameCapture->writtenFrames(),
+                  frameCapture->directory().string(), frameCapture->droppedFrames());
+    }
 }
 
-void render(SDL_Renderer*& renderer, ColorBufferArray& colorBuffer, SDL_Texture*& colorBufferTexture)
+// "--resolution WIDTHxHEIGHT" picks the internal resolution (the window size otherwise),
+// "--dynamic-resolution" starts with frame-time driven scaling enabled,
+// "--pipelined" overlaps the geometry of the next frame with the raster of the current one,
+// "--capture DIRECTORY" saves every frame as PNG there from the start (F12 toggles it into ./captures),
+// "--stream PATH" writes every frame to a file, named pipe or stdout ("-", needs a build without debug logs)
+// as "--stream-format y4m" (default) or "rgba",
+// "--mesh NAME" adds assets/NAME.obj to the scene, textured with assets/NAME.png if it exists; repeat it for more,
+// "--instances N" places N copies of every mesh, sharing its geometry and texture
+Resolution parseLaunchOptions(const int argc, char* argv[])
 {
-    auto renderColorBuffer = [&]()
+    Resolution resolution{};
+    for (int i = 1; i < argc; ++i)
     {
-      SDL_UpdateTexture(colorBufferTexture, nullptr, colorBuffer.data(), static_cast<int>(WINDOW_WIDTH * sizeof(uint32_t)));
-      SDL_RenderCopy(renderer, colorBufferTexture, nullptr, nullptr);
-    };
+        const std::string_view option{argv[i]};
+        if (option == "--dynamic-resolution")
+        {
+            isDynamicResolutionEnabled = true;
+            continue;
+        }
 
-    for (auto& triangle : trianglesToRender)
-    {
-        auto points{triangle._points};
-        auto [point0,point1,point2] = points;
+        if (option == "--pipelined")
+        {
+            isPipelineEnabled = true;
+            continue;
+        }
 
+        if (option == "--capture" && i + 1 < argc)
+        {
+            captureDirectory = argv[++i];
+            isCaptureEnabled = true;
+            continue;
+        }
 
-        if (   renderingState == RenderingStates::WIREFRAME_WITH_VERTICES)
+        if (option == "--stream" && i + 1 < argc)
         {
-            // For each point in the triangle, draw a small red dot (wireframe with vertices)
-            std::ranges::for_each(points, [&colorBuffer](const auto& point)
-            {
-                Render::drawRect(colorBuffer, point.x, point.y, 3, 3, toColorValue(Colors::RED));
-            });
+            streamPath = argv[++i];
+            continue;
         }
 
-        if (
-               renderingState == RenderingStates::FILLED_TRIANGLES
-            || renderingState == RenderingStates::FILLED_TRIANGLES_WITH_WIREFRAME ) {
-            // Draw a filled triangle with a flat bottom in green color (solid color rendering)
-            Render::drawFilledTriangleFlatBottom(colorBuffer, Triangle(points), triangle._color);
+        if (option == "--mesh" && i + 1 < argc)
+        {
+            sceneAssets.emplace_back(argv[++i]);
+            continue;
+        }
 
-            // Draw the triangle's outline (wireframe) in green color
-            Render::drawTriangle(colorBuffer, {point0.x, point0.y}, {point1.x, point1.y}, {point2.x, point2.y}, triangle._color);
+        if (option == "--instances" && i + 1 < argc)
+        {
+            const std::string_view value{argv[++i]};
+            size_t count{0};
+            std::from_chars(value.data(), value.data() + value.size(), count);
+            instancesPerAsset = std::max<size_t>(count, 1u);
+            continue;
         }
 
-        if (
-            renderingState == RenderingStates::TEXTURED_TRIANGLES
-            || renderingState == RenderingStates::TEXTURED_TRIANGLES_WITH_WIREFRAME)
+        if (option == "--stream-format" && i + 1 < argc)
         {
-            Render::drawTexturedTriangle(colorBuffer, triangle, textureMesh, zBuffer);
+            const std::string_view format{argv[++i]};
+            streamFormat = format == "rgba" ? Utils::StreamFormat::RGBA : Utils::StreamFormat::Y4M;
+            continue;
         }
 
-        if (
-               renderingState == RenderingStates::WIREFRAME_ONLY
-            || renderingState == RenderingStates::WIREFRAME_WITH_VERTICES
-            || renderingState == RenderingStates::TEXTURED_TRIANGLES_WITH_WIREFRAME)
+        if (option != "--resolution" || i + 1 >= argc)
         {
-            // Draw the triangle's outline (wireframe) in blue color
-            Render::drawTriangle(colorBuffer, {point0.x, point0.y}, {point1.x, point1.y}, {point2.x, point2.y}, toColorValue(Colors::WHITE));
+            continue;
         }
 
+        const std::string_view value{argv[++i]};
+        const auto separator = value.find('x');
+        Resolution parsed{0u, 0u};
+        if (separator != std::string_view::npos)
+        {
+            std::from_chars(value.data(), value.data() + separator, parsed.width);
+            std::from_chars(value.data() + separator + 1, value.data() + value.size(), parsed.height);
+        }
 
+        if (parsed.width > 0 && parsed.height > 0)
+        {
+            resolution = parsed;
+        }
+        else
+        {
+            std::cerr << std::format("Ignoring invalid resolution: {}", argv[i]) << std::endl;
+        }
     }
-    renderColorBuffer();
-    std::memset(colorBuffer.data(), 0, colorBuffer.size() * sizeof(uint32_t));
-    std::fill_n(zBuffer.begin(), zBuffer.size(), 1.0f);
-    SDL_RenderPresent(renderer);
 
+    return resolution;
 }
 
-void setup(SDL_Renderer*& renderer, ColorBufferArray& colorBuffer, SDL_Texture*& colorBufferTexture)
+// Loads assets/NAME.obj, and assets/NAME.png when there is one, into the scene once and places a copy of it
+// on every position: centered on it and scaled to the size of the cube
+void addAsset(const std::string& name, const std::span<const vect3_t<float>> positions)
 {
-    std::ranges::fill(colorBuffer, ZERO_VALUE_COLOR_BUFFER);
-    colorBufferTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR32, SDL_TEXTUREACCESS_STREAMING,
-                                           WINDOW_WIDTH, WINDOW_HEIGHT);
-
-    zBuffer.reserve(WINDOW_WIDTH * WINDOW_HEIGHT);
-    zBuffer.resize(WINDOW_WIDTH * WINDOW_HEIGHT);
-    std::fill_n(zBuffer.begin(), zBuffer.size(), 1.0f);
-
+    const std::filesystem::path assets{"./assets"};
+    std::vector<vect3_t<float>> vertices;
+    std::vector<Face> faces;
+    LoadOBJFileSimplified(assets / (name + ".obj"), vertices, faces);
+    if (faces.empty())
+    {
+        std::cerr << std::format("No faces loaded for {}", name) << std::endl;
+        return;
+    }
 
-    constexpr auto fovY = glm::radians(60.0f);
-    constexpr float aspect = WINDOW_WIDTH / static_cast<float>(WINDOW_HEIGHT);
+    const MeshId mesh = scene.addMesh(makeMesh(std::move(vertices), std::move(faces)));
 
-    const float fovX = 2.0f * std::atan(std::tan(fovY / 2.0f) * aspect);
+    TextureId texture{NO_TEXTURE};
+    const auto texturePath = assets / (name + ".png");
+    if (std::filesystem::exists(texturePath))
+    {
+        Texture2dArray loaded;
+        loaded.data = LoadPngToSDLExpectedFormat(texturePath.string(), loaded.width, loaded.height);
+        texture = scene.addTexture(std::move(loaded));
+    }
 
-    constexpr float zNear = 0.1f;
-    constexpr float zFar = 100.0f;
+    // The cube's bounding box has a diagonal of 2 * sqrt(3)
+    const auto& bounds = scene.mesh(mesh).bounds;
+    const auto extent = bounds.max - bounds.min;
+    const float diagonal = std::sqrt(extent.x * extent.x + extent.y * extent.y + extent.z * extent.z);
+    const float scale = diagonal > 0.0f ? 2.0f * std::sqrt(3.0f) / diagonal : 1.0f;
+    const auto center = (bounds.min + bounds.max) * 0.5f;
 
-    projectionMat = Utils::makePerspectiveMat4(fovY, aspect, zNear, zFar);
-    frustum = std::make_unique<Frustum>(fovX, fovY, zNear, zFar);
+    std::vector<Transform> transforms;
+    transforms.reserve(positions.size());
+    for (const auto& position : positions)
+    {
+        transforms.push_back({.scale = {scale, scale, scale}, .translation = position - center * scale});
+    }
+    scene.addInstances(mesh, transforms, texture);
+}
 
-    std::vector<vect3_t<float>> loadedVertex;
-    std::vector<Face> loadedFaces;
-    LoadOBJFileSimplified("./assets/cube.obj", loadedVertex, loadedFaces);
+void setup(SDL_Renderer*& renderer, Render::RenderTarget& renderTarget, SDL_Texture*& colorBufferTexture)
+{
+    renderTarget.color().fill(ZERO_VALUE_COLOR_BUFFER);
+    colorBufferTexture = createColorBufferTexture(renderer, renderTarget);
 
-    std::vector<unsigned char> png;
-    std::vector<unsigned char> image; //the raw pixels
-    int width, height;
+    threadPool = std::make_unique<Utils::ThreadPool>();
+    geometryStage = std::make_unique<Render::GeometryStage>(Render::ProjectionSettings{FOV_Y, Z_NEAR, Z_FAR},
+                                                            FRAME_PERIOD, threadPool.get());
 
-    //load and decode
-    auto texture = LoadPngToSDLExpectedFormat("./assets/cube.png", width, height);
-    textureMesh.width = width;
-    textureMesh.height = height;
-    textureMesh.data.insert(textureMesh.data.end(), std::make_move_iterator(texture.begin()), std::make_move_iterator(texture.end()));
-    // //Fancy modern cpp way with chunks
-    // textureMesh.reserve(REDBRICK_TEXTURE.size() / 4);
-    // for (const auto chunk : REDBRICK_TEXTURE | std::views::chunk(4))
-    // {
-    //     uint32_t textureColor = chunk[3] << 24 | chunk[0] << 16 | chunk[1] << 8 | chunk[2];
-    //     textureMesh.emplace_back(textureColor);
-    // }
+    if (sceneAssets.empty())
+    {
+        sceneAssets.emplace_back("cube");
+    }
 
+    // The assets in a row in front of the camera, the copies of each in a square block of their own,
+    // moved back as the row gets wider and the blocks taller
+    constexpr float SPACING = 3.5f;
+    const auto blockSide = static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(instancesPerAsset))));
+    const float blockCenter = static_cast<float>(blockSide - 1u) / 2.0f;
+    const float rowDepth = 4.0f + 1.5f * static_cast<float>(sceneAssets.size() * blockSide - 1u)
+                         + 3.2f * static_cast<float>(blockSide - 1u);
 
-    std::ranges::copy(loadedVertex, std::back_inserter(globalMesh.vertices));
-    std::ranges::copy(loadedFaces, std::back_inserter(globalMesh.faces));
+    std::vector<vect3_t<float>> positions(instancesPerAsset);
+    for (size_t i = 0; i < sceneAssets.size(); ++i)
+    {
+        const float block = static_cast<float>(i) - static_cast<float>(sceneAssets.size() - 1u) / 2.0f;
+        for (size_t copy = 0; copy < instancesPerAsset; ++copy)
+        {
+            const float column = static_cast<float>(copy % blockSide) - blockCenter;
+            const float row = static_cast<float>(copy / blockSide) - blockCenter;
+            positions[copy] = {SPACING * (static_cast<float>(blockSide) * block + column), -SPACING * row, rowDepth};
+        }
+        addAsset(sceneAssets[i], positions);
+    }
+    // The first object goes into the occlusion buffer, whatever the camera sees behind it is never transformed
+    if (!scene.instances().empty())
+    {
+        scene.setOccluder(0u, true);
+    }
+    geometryStage->setScene(&scene);
 }
 
 void CleanUp(SDL_Window*& window, SDL_Renderer*& renderer, SDL_Texture*& texture)
@@ -477,19 +638,57 @@ int main(int argc, char* argv[])
         return hasError;
     }
 
+    const auto [targetWidth, targetHeight] = parseLaunchOptions(argc, argv);
+    Render::RenderTarget renderTarget{targetWidth, targetHeight, requestedDepthFormat, {Z_NEAR, Z_FAR}};
+
     SDL_Texture* colorBufferTexture;
-    ColorBufferArray colorBuffer{};
-    colorBuffer.resize(COLOR_BUFFER_SIZE);
-    setup(renderer,colorBuffer,colorBufferTexture);
+    setup(renderer,renderTarget,colorBufferTexture);
+
+    if (streamPath)
+    {
+#if defined(SIGPIPE)
+        // An encoder that exits early closes the pipe; the failed write stops the stream instead of the process
+        std::signal(SIGPIPE, SIG_IGN);
+#endif
+        frameStream = std::make_unique<Utils::FrameStream>(*streamPath, streamFormat, renderTarget.capacityWidth(),
+                                                           renderTarget.capacityHeight(), TARGETED_FRAME_RATE);
+    }
     auto quit{false};
 
+    std::thread geometryThread{runGeometryStage};
+
+    auto lastStatsReport = Utils::FrameScheduler::Clock::now();
     while (!quit)
     {
+        const auto frameTime = frameScheduler.waitForNextFrame();
+
         processInput(quit);
-        update();
-        render(renderer, colorBuffer, colorBufferTexture);
+        applyRenderTargetRequests(renderer, renderTarget, colorBufferTexture);
+        submitFrame(renderTarget, frameTime);
+
+        // Pipelined, the frame submitted last time is rasterized while the geometry thread works on this one;
+        // otherwise the frame just submitted is waited for. Leaving pipelined mode draws both in flight.
+        const size_t framesToKeep = isPipelineEnabled ? 1u : 0u;
+        while (framesInFlight > framesToKeep)
+        {
+            render(renderer, renderTarget, colorBufferTexture);
+        }
+        updateDynamicResolution(renderTarget);
+
+        if (const auto now = Utils::FrameScheduler::Clock::now(); now - lastStatsReport >= FRAME_STATS_INTERVAL)
+        {
+            reportFrameStats(window, frameScheduler.takeStats(), renderTarget);
+            lastStatsReport = now;
+        }
     }
 
+    frameRing.stop();
+    geometryThread.join();
+
+    // Waits for the frames still being encoded or written
+    frameCapture.reset();
+    frameStream.reset();
+
     CleanUp(window, renderer, colorBufferTexture);
 
     return 0;